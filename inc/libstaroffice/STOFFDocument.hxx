@@ -44,6 +44,8 @@ namespace librevenge
 class RVNGBinaryData;
 class RVNGDrawingInterface;
 class RVNGPresentationInterface;
+class RVNGPropertyList;
+class RVNGString;
 class RVNGSpreadsheetInterface;
 class RVNGTextInterface;
 class RVNGInputStream;
@@ -136,6 +138,80 @@ public:
    \note Can only convert some basic documents: retrieving more cells' contents but no formating. */
   static STOFFLIB Result parse(librevenge::RVNGInputStream *input, librevenge::RVNGSpreadsheetInterface *documentInterface, char const *password=nullptr);
 
+  // ------------------------------------------------------------
+  // the text only parsers
+  // ------------------------------------------------------------
+
+  /** Parses the input stream content as parse but only retrieves the document's text, which is
+     useful to index a document: the layout, the page styles, the numbering, the preview and the
+     embedded objects are ignored, the drawing layers of the text and the spreadsheet documents
+     too. The paragraph and character styles, the cells' attributes and numbering styles and
+     the shapes' styles are not retrieved; only the text boxes of the drawings and the
+     presentations are sent. So the document is sent with a minimal structure.
+     \note the text of the headers, the footers and of the shapes of text and spreadsheet documents is lost.
+     \param input The input stream
+     \param documentInterface A RVNGTextInterface implementation
+     \param password The file password */
+  static STOFFLIB Result parseTextOnly(librevenge::RVNGInputStream *input, librevenge::RVNGTextInterface *documentInterface, char const *password=nullptr);
+  /** Parses the input stream content and only retrieves the document's text, see parseTextOnly.
+     \param input The input stream
+     \param documentInterface A RVNGDrawingInterface implementation
+     \param password The file password */
+  static STOFFLIB Result parseTextOnly(librevenge::RVNGInputStream *input, librevenge::RVNGDrawingInterface *documentInterface, char const *password=nullptr);
+  /** Parses the input stream content and only retrieves the document's text, see parseTextOnly.
+     \param input The input stream
+     \param documentInterface A RVNGPresentationInterface implementation
+     \param password The file password */
+  static STOFFLIB Result parseTextOnly(librevenge::RVNGInputStream *input, librevenge::RVNGPresentationInterface *documentInterface, char const *password=nullptr);
+  /** Parses the input stream content and only retrieves the document's text, see parseTextOnly.
+     \param input The input stream
+     \param documentInterface A RVNGSpreadsheetInterface implementation
+     \param password The file password */
+  static STOFFLIB Result parseTextOnly(librevenge::RVNGInputStream *input, librevenge::RVNGSpreadsheetInterface *documentInterface, char const *password=nullptr);
+
+  // ------------------------------------------------------------
+  // the page range parsers
+  // ------------------------------------------------------------
+
+  /** Parses the input stream content as parse but only sends the pages firstPage...lastPage
+     and their master pages. The objects of the other pages are not read.
+     \note returns STOFF_R_PARSE_ERROR if the document does not contain any page in this range.
+     \param input The input stream
+     \param documentInterface A RVNGDrawingInterface implementation
+     \param firstPage The first page to send (1 means the first page)
+     \param lastPage The last page to send (0 means the document's last page)
+     \param password The file password */
+  static STOFFLIB Result parsePages(librevenge::RVNGInputStream *input, librevenge::RVNGDrawingInterface *documentInterface, int firstPage, int lastPage, char const *password=nullptr);
+  /** Parses the input stream content and only sends the slides firstPage...lastPage, see parsePages.
+     \param input The input stream
+     \param documentInterface A RVNGPresentationInterface implementation
+     \param firstPage The first slide to send (1 means the first slide)
+     \param lastPage The last slide to send (0 means the document's last slide)
+     \param password The file password */
+  static STOFFLIB Result parsePages(librevenge::RVNGInputStream *input, librevenge::RVNGPresentationInterface *documentInterface, int firstPage, int lastPage, char const *password=nullptr);
+
+  // ------------------------------------------------------------
+  // the meta data and the thumbnail
+  // ------------------------------------------------------------
+
+  /** Retrieves the document's meta data (title, author, dates, ...) without parsing its content:
+     only the SfxDocumentInfo and the SummaryInformation zones of the OLE container are read.
+     \param input The input stream
+     \param metaData The property list which is filled with the meta data, using the
+     keys sent by the parsers to setDocumentMetaData (dc:title, meta:initial-creator, ...)
+     \note the meta data of a password protected document can be retrieved without its password */
+  static STOFFLIB Result parseMetaData(librevenge::RVNGInputStream *input, librevenge::RVNGPropertyList &metaData);
+
+  /** Retrieves the document's preview picture (the thumbnail stored in the SfxPreview zone)
+     without parsing its content.
+     \param input The input stream
+     \param picture The picture data
+     \param mimeType The picture mime type: "image/png" or, if zlib is not available, "image/ppm"
+     when the preview contains a bitmap; "image/svg" when it only contains some vector drawing
+     (most StarOffice previews), the picture is then the preview's StarView metafile (SVGDI)
+     \note the preview of a password protected document is not encrypted */
+  static STOFFLIB Result parseThumbnail(librevenge::RVNGInputStream *input, librevenge::RVNGBinaryData &picture, librevenge::RVNGString &mimeType);
+
   // ------------------------------------------------------------
   // decoders of the embedded zones created by libstoff
   // ------------------------------------------------------------
@@ -0,0 +1,111 @@
+#!/usr/bin/perl
+#
+# benchmark.pl: measures the time (and if possible the memory) needed by a
+# converter to parse some large documents.
+#
+# By default, the documents are created by generate_corpus.pl in a temporary
+# directory, but a list of files can also be given.
+#
+# Usage: benchmark.pl [options] [files]
+#   see benchmark.pl --help
+
+use strict;
+use warnings;
+use Getopt::Long;
+use File::Basename;
+use File::Temp qw(tempdir);
+use Time::HiRes qw(time);
+
+my $dir = dirname(__FILE__);
+my $command = "sd2raw";
+my $repeat = 3;
+my $size = "medium";
+my $keep = 0;
+my $help = 0;
+
+GetOptions("command=s" => \$command, "repeat=i" => \$repeat, "size=s" => \$size,
+	   "keep" => \$keep, "help" => \$help) or Usage(1);
+Usage(0) if $help;
+
+sub Usage
+{
+  my ($res) = @_;
+  print <<EOF;
+Usage: benchmark.pl [options] [files]
+
+Runs a converter on some large documents and prints the elapsed time and
+the maximum resident memory of each run. If no file is given, the
+documents are created by generate_corpus.pl.
+
+Options:
+  --command=cmd    the converter to test (default: $command)
+  --repeat=n       number of runs by document (default: $repeat)
+  --size=s         the size of the generated documents: small, medium or
+                   large (default: $size)
+  --keep           do not remove the generated documents
+EOF
+  exit($res);
+}
+
+# the generated documents: name => generate_corpus.pl options
+my %corpus = (
+  "small" => { "calc.sdc" => "--rows=1000 --columns=20",
+	       "calc-notes.sdc" => "--rows=1000 --columns=20 --notes=10",
+	       "text.sdw" => "--paragraphs=2000",
+	       "draw.sda" => "--pages=10 --objects=100",
+	       "impress.sdd" => "--pages=10 --objects=50" },
+  "medium" => { "calc.sdc" => "--sheets=2 --rows=8000 --columns=20",
+		"calc-notes.sdc" => "--rows=8000 --columns=20 --notes=10",
+		"text.sdw" => "--paragraphs=20000",
+		"draw.sda" => "--pages=50 --objects=200",
+		"impress.sdd" => "--pages=50 --objects=100" },
+  "large" => { "calc.sdc" => "--sheets=8 --rows=8000 --columns=40",
+	       "calc-notes.sdc" => "--sheets=2 --rows=8000 --columns=40 --notes=10",
+	       "text.sdw" => "--paragraphs=100000",
+	       "draw.sda" => "--pages=200 --objects=500",
+	       "impress.sdd" => "--pages=200 --objects=250" },
+    );
+die "benchmark.pl: unknown size \"$size\"\n" if !defined $corpus{$size};
+
+my @files = @ARGV;
+my $tmpDir;
+if (!@files) {
+  $tmpDir = tempdir("stoff-benchmark-XXXXXX", TMPDIR => 1, CLEANUP => !$keep);
+  foreach my $name (sort keys %{$corpus{$size}}) {
+    my $file = "$tmpDir/$name";
+    print "generate $file\n";
+    system("perl $dir/generate_corpus.pl $corpus{$size}{$name} $file") == 0
+      or die "benchmark.pl: can not generate \"$file\"\n";
+    push @files, $file;
+  }
+  print "the generated documents are kept in $tmpDir\n" if $keep;
+}
+
+# use GNU time to retrieve the maximum resident memory if it exists
+my $timeCommand = (-x "/usr/bin/time" && `/usr/bin/time -f %M true 2>&1` =~ /^\d+\s*$/) ?
+  "/usr/bin/time -f %M" : "";
+
+printf("\n%-40s %10s %10s %10s %10s\n", "File", "Size(kB)", "Min(s)", "Mean(s)", "Mem(kB)");
+foreach my $file (@files) {
+  my ($min, $total, $memory) = (-1, 0, 0);
+  my $failed = 0;
+  for (my $i = 0; $i < $repeat; ++$i) {
+    my $start = time();
+    my $output = `$timeCommand $command "$file" 2>&1 >/dev/null`;
+    my $elapsed = time() - $start;
+    if ($?) {
+      $failed = 1;
+      last;
+    }
+    $memory = $1 if $timeCommand && $output =~ /(\d+)\s*$/ && $1 > $memory;
+    $min = $elapsed if $min < 0 || $elapsed < $min;
+    $total += $elapsed;
+  }
+  my $name = basename($file);
+  if ($failed) {
+    printf("%-40s %10d %10s\n", $name, (-s $file)/1024, "failed");
+    next;
+  }
+  printf("%-40s %10d %10.3f %10.3f %10s\n", $name, (-s $file)/1024, $min, $total/$repeat,
+	 $timeCommand ? $memory : "-");
+}
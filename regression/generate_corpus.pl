@@ -0,0 +1,793 @@
+#!/usr/bin/perl
+#
+# generate_corpus.pl: creates synthetic StarCalc (.sdc), StarWriter (.sdw),
+# StarDraw (.sda) and StarImpress (.sdd) files of configurable size, to
+# benchmark the parsers on documents much larger than the regression files.
+#
+# The generated files reuse the OLE structure, the item pools and the styles
+# of a small template document (by default, one of the regression files):
+# - .sdc: the StarCalcDocument tables are replaced by synthetic tables
+#   (sheets x rows x columns) whose cells are values, strings or formulas
+#   and whose cell attributes are chosen among the template's cell patterns,
+# - .sdw: the main text content is filled by copies of the template's
+#   paragraphs (and of its graphic nodes if it has some),
+# - .sda/.sdd: the first page is filled by copies of the template's drawing
+#   objects (and of its graphic objects) and then the page is duplicated.
+#
+# Usage: generate_corpus.pl [options] output.sd[cawd]
+#   see generate_corpus.pl --help
+
+use strict;
+use warnings;
+use Getopt::Long;
+use File::Basename;
+
+my $dir = dirname(__FILE__);
+my %opt = (
+  "seed" => 1,
+  # .sdc options
+  "sheets" => 1, "rows" => 1000, "columns" => 20,
+  "values" => 60, "strings" => 20, "formulas" => 20, "notes" => 0,
+  "styles" => 8,
+  # .sdw options
+  "paragraphs" => 5000, "images" => 0,
+  # .sda options
+  "pages" => 10, "objects" => 100,
+);
+my $template;
+my $help = 0;
+
+GetOptions(\%opt, "seed=i",
+	   "sheets=i", "rows=i", "columns=i", "values=i", "strings=i", "formulas=i", "notes=i", "styles=i",
+	   "paragraphs=i", "images=i", "pages=i", "objects=i",
+	   "template=s" => \$template, "help" => \$help) or Usage(1);
+Usage(0) if $help;
+Usage(1) if @ARGV != 1;
+
+sub Usage
+{
+  my ($res) = @_;
+  print <<EOF;
+Usage: generate_corpus.pl [options] output.sd[cawd]
+
+Creates a synthetic StarOffice file, the kind of file is given by the
+output extension: .sdc (StarCalc), .sdw (StarWriter), .sda (StarDraw)
+or .sdd (StarImpress).
+
+General options:
+  --template=file  the document used as template (default: a regression file)
+  --seed=n         the random seed (default: $opt{"seed"})
+StarCalc options:
+  --sheets=n       number of sheets (default: $opt{"sheets"})
+  --rows=n         number of rows by sheet (default: $opt{"rows"})
+  --columns=n      number of columns by sheet (default: $opt{"columns"}, max 256)
+  --values=p       relative frequency of the value cells (default: $opt{"values"})
+  --strings=p      relative frequency of the string cells (default: $opt{"strings"})
+  --formulas=p     relative frequency of the formula cells (default: $opt{"formulas"})
+  --notes=p        percentage of cells with a note (default: $opt{"notes"})
+  --styles=n       number of different cell styles (default: $opt{"styles"}),
+                   bounded by the number of styles found in the template
+StarWriter options:
+  --paragraphs=n   number of paragraphs (default: $opt{"paragraphs"})
+  --images=n       number of graphic nodes (default: $opt{"images"}), only if
+                   the template contains some graphic nodes in its main text
+StarDraw and StarImpress options:
+  --pages=n        number of pages (default: $opt{"pages"})
+  --objects=n      number of drawing objects by page (default: $opt{"objects"})
+  --images=n       number of graphic objects by page (default: $opt{"images"})
+EOF
+  exit($res);
+}
+
+srand($opt{"seed"});
+my $output = $ARGV[0];
+my ($kind) = ($output =~ /\.(sd[cawd])$/i);
+die "generate_corpus.pl: unknown output kind for \"$output\"\n" if !$kind;
+$kind = lc($kind);
+
+my %defaultTemplate = ("sdc" => "Calc5/go-oox-5.sdc",
+		       "sdw" => "Text5/go-oox-5.sdw",
+		       "sda" => "Draw5/testField.sda",
+		       "sdd" => "Pres5/go-oox-5.sdd");
+$template = "$dir/$defaultTemplate{$kind}" if !defined $template;
+
+my @streams = ReadOLE($template);
+my $mainName = $kind eq "sdc" ? "StarCalcDocument" : $kind eq "sdw" ? "StarWriterDocument" : "StarDrawDocument";
+my $found = 0;
+foreach my $stream (@streams) {
+  next if $stream->{"name"} !~ /^$mainName\d?$/;
+  $stream->{"data"} = CreateCalcDocument($stream->{"data"}) if $kind eq "sdc";
+  $stream->{"data"} = CreateWriterDocument($stream->{"data"}) if $kind eq "sdw";
+  $stream->{"data"} = CreateDrawDocument($stream->{"data"}) if $kind eq "sda" || $kind eq "sdd";
+  $found = 1;
+}
+die "generate_corpus.pl: can not find the $mainName stream in \"$template\"\n" if !$found;
+WriteOLE($output, @streams);
+exit(0);
+
+########################################
+# generic helpers
+########################################
+
+sub U8 { return pack("C", $_[0]); }
+sub U16 { return pack("v", $_[0]); }
+sub U32 { return pack("V", $_[0]); }
+sub Double { return pack("d<", $_[0]); }
+# a string preceded by its 16 bits length
+sub String { return pack("v", length($_[0])) . $_[0]; }
+
+sub ReadU8 { my ($data, $pos) = @_; return unpack("C", substr($data, $pos, 1)); }
+sub ReadU16 { my ($data, $pos) = @_; return unpack("v", substr($data, $pos, 2)); }
+sub ReadU32 { my ($data, $pos) = @_; return unpack("V", substr($data, $pos, 4)); }
+
+# returns a random index using a list of relative frequencies
+sub RandomChoice
+{
+  my (@freq) = @_;
+  my $sum = 0;
+  $sum += $_ foreach (@freq);
+  return 0 if $sum <= 0;
+  my $val = rand($sum);
+  for (my $i = 0; $i < @freq; ++$i) {
+    return $i if $val < $freq[$i];
+    $val -= $freq[$i];
+  }
+  return @freq-1;
+}
+
+sub RandomWord
+{
+  my @syllables = ("ka", "lo", "mi", "nu", "re", "sto", "fa", "ber", "tin", "gu", "pel", "da");
+  my $word = "";
+  $word .= $syllables[int(rand(@syllables))] for (0..int(rand(3)));
+  return $word;
+}
+
+########################################
+# OLE2 compound document
+########################################
+
+# returns the list of streams: {"name" => full name, "data" => content}
+sub ReadOLE
+{
+  my ($file) = @_;
+  open(my $fh, "<", $file) or die "generate_corpus.pl: can not open \"$file\"\n";
+  binmode($fh);
+  local $/;
+  my $data = <$fh>;
+  close($fh);
+  die "generate_corpus.pl: \"$file\" is not an OLE2 file\n"
+    if length($data) < 512 || substr($data, 0, 8) ne "\xd0\xcf\x11\xe0\xa1\xb1\x1a\xe1";
+
+  my $bigSize = 1 << ReadU16($data, 0x1e);
+  my $smallSize = 1 << ReadU16($data, 0x20);
+  my ($numBat, $dirStart) = (ReadU32($data, 0x2c), ReadU32($data, 0x30));
+  my $threshold = ReadU32($data, 0x38);
+  my ($sbatStart, $numSbat) = (ReadU32($data, 0x3c), ReadU32($data, 0x40));
+  my ($mbatStart, $numMbat) = (ReadU32($data, 0x44), ReadU32($data, 0x48));
+  my @batBlocks;
+  for (my $i = 0; $i < 109 && @batBlocks < $numBat; ++$i) {
+    push @batBlocks, ReadU32($data, 0x4c + 4*$i);
+  }
+  for (my $i = 0, my $mb = $mbatStart; $i < $numMbat && $mb < 0xfffffffa; ++$i) {
+    my $base = 512 + $mb*$bigSize;
+    for (my $j = 0; $j < $bigSize/4 - 1 && @batBlocks < $numBat; ++$j) {
+      push @batBlocks, ReadU32($data, $base + 4*$j);
+    }
+    $mb = ReadU32($data, $base + $bigSize - 4);
+  }
+  my @bat;
+  push @bat, unpack("V*", substr($data, 512 + $_*$bigSize, $bigSize)) foreach (@batBlocks);
+  my $readChain = sub {
+    my ($start, $table, $source, $size, $offset) = @_;
+    my $res = "";
+    my %seen;
+    for (my $b = $start; $b < @$table && !$seen{$b}; $b = $table->[$b]) {
+      $seen{$b} = 1;
+      $res .= substr($$source, $offset + $b*$size, $size);
+    }
+    return $res;
+  };
+  my $dir = $readChain->($dirStart, \@bat, \$data, $bigSize, 512);
+  my @sbat = unpack("V*", $numSbat ? $readChain->($sbatStart, \@bat, \$data, $bigSize, 512) : "");
+  my @entries;
+  for (my $p = 0; $p + 128 <= length($dir); $p += 128) {
+    my $nameLength = ReadU16($dir, $p + 0x40);
+    my $name = $nameLength >= 2 ? substr($dir, $p, $nameLength - 2) : "";
+    $name =~ s/(.)\0/$1/gs;
+    push @entries, { "name" => $name, "type" => ReadU8($dir, $p + 0x42),
+		     "left" => ReadU32($dir, $p + 0x44), "right" => ReadU32($dir, $p + 0x48),
+		     "child" => ReadU32($dir, $p + 0x4c), "clsid" => substr($dir, $p + 0x50, 16),
+		     "start" => ReadU32($dir, $p + 0x74), "size" => ReadU32($dir, $p + 0x78) };
+  }
+  die "generate_corpus.pl: can not read the OLE directory of \"$file\"\n" if !@entries;
+  my $smallData = $readChain->($entries[0]->{"start"}, \@bat, \$data, $bigSize, 512);
+
+  my @streams;
+  my %visited;
+  my $visit;
+  $visit = sub {
+    my ($id, $prefix) = @_;
+    return if $id >= @entries || $visited{$id};
+    $visited{$id} = 1;
+    my $entry = $entries[$id];
+    $visit->($entry->{"left"}, $prefix);
+    if ($entry->{"type"} == 2) {
+      my $content = $entry->{"size"} < $threshold ?
+	$readChain->($entry->{"start"}, \@sbat, \$smallData, $smallSize, 0) :
+	$readChain->($entry->{"start"}, \@bat, \$data, $bigSize, 512);
+      push @streams, { "name" => $prefix . $entry->{"name"}, "data" => substr($content, 0, $entry->{"size"}) };
+    }
+    elsif ($entry->{"type"} == 1) {
+      push @streams, { "name" => $prefix . $entry->{"name"}, "storage" => 1, "clsid" => $entry->{"clsid"} };
+      $visit->($entry->{"child"}, $prefix . $entry->{"name"} . "/");
+    }
+    $visit->($entry->{"right"}, $prefix);
+  };
+  push @streams, { "name" => "", "storage" => 1, "clsid" => $entries[0]->{"clsid"} };
+  $visit->($entries[0]->{"child"}, "");
+  return @streams;
+}
+
+# writes the streams in a OLE2 file (512 bytes sectors, 64 bytes small sectors)
+sub WriteOLE
+{
+  my ($file, @streams) = @_;
+  # create the directory entries
+  my @entries;
+  my %storageId;
+  foreach my $stream (@streams) {
+    my $name = $stream->{"name"};
+    my ($parent, $base) = ($name =~ m|^(?:(.*)/)?([^/]*)$|);
+    $parent = "" if !defined $parent;
+    my $entry = { "name" => $name eq "" ? "Root Entry" : $base, "children" => [],
+		  "type" => $name eq "" ? 5 : $stream->{"storage"} ? 1 : 2,
+		  "clsid" => $stream->{"clsid"} || ("\0" x 16), "data" => $stream->{"data"} };
+    push @entries, $entry;
+    $storageId{$name} = @entries-1 if $stream->{"storage"};
+    push @{$entries[$storageId{$parent}]->{"children"}}, @entries-1 if $name ne "";
+  }
+  # the mini stream
+  my $smallData = "";
+  my @sbat;
+  foreach my $entry (@entries) {
+    next if $entry->{"type"} != 2 || length($entry->{"data"}) >= 4096;
+    my $numBlocks = int((length($entry->{"data"}) + 63)/64);
+    $entry->{"start"} = $numBlocks ? @sbat : 0xfffffffe;
+    push @sbat, (@sbat+1 .. @sbat+$numBlocks-1), 0xfffffffe if $numBlocks;
+    my $content = $entry->{"data"};
+    $content .= "\0" x ($numBlocks*64 - length($content));
+    $smallData .= $content;
+  }
+  # the big blocks: the streams, the mini stream, the small bat and the directory
+  my $sectors = "";
+  my @bat;
+  my $addChain = sub {
+    my ($content) = @_;
+    my $numBlocks = int((length($content) + 511)/512);
+    return 0xfffffffe if !$numBlocks;
+    my $start = @bat;
+    push @bat, (@bat+1 .. @bat+$numBlocks-1), 0xfffffffe;
+    $sectors .= $content . ("\0" x ($numBlocks*512 - length($content)));
+    return $start;
+  };
+  foreach my $entry (@entries) {
+    next if $entry->{"type"} != 2 || length($entry->{"data"}) < 4096;
+    $entry->{"start"} = $addChain->($entry->{"data"});
+  }
+  $entries[0]->{"start"} = $addChain->($smallData);
+  $entries[0]->{"data"} = $smallData;
+  my $numSbat = int((@sbat*4 + 511)/512);
+  my $sbatStart = $addChain->(pack("V*", @sbat) . pack("V", 0xffffffff) x ($numSbat*128 - @sbat));
+  # the directory: each storage's children are stored as a balanced binary tree
+  foreach my $entry (@entries) {
+    $entry->{"left"} = $entry->{"right"} = $entry->{"child"} = 0xffffffff;
+  }
+  my $buildTree;
+  $buildTree = sub {
+    my (@list) = @_;
+    return 0xffffffff if !@list;
+    my $mid = int(@list/2);
+    my $root = $list[$mid];
+    $entries[$root]->{"left"} = $buildTree->(@list[0 .. $mid-1]);
+    $entries[$root]->{"right"} = $buildTree->(@list[$mid+1 .. @list-1]);
+    return $root;
+  };
+  foreach my $entry (@entries) {
+    next if $entry->{"type"} == 2;
+    my @children = sort { length($entries[$a]->{"name"}) <=> length($entries[$b]->{"name"}) ||
+			    uc($entries[$a]->{"name"}) cmp uc($entries[$b]->{"name"}) } @{$entry->{"children"}};
+    $entry->{"child"} = $buildTree->(@children);
+  }
+  my $dir = "";
+  foreach my $entry (@entries) {
+    my $name = join("", map { $_ . "\0" } split(//, $entry->{"name"})) . "\0\0";
+    $dir .= $name . ("\0" x (64 - length($name)));
+    $dir .= pack("vCC", length($name), $entry->{"type"}, 1);
+    $dir .= pack("VVV", $entry->{"left"}, $entry->{"right"}, $entry->{"child"});
+    $dir .= $entry->{"clsid"} . ("\0" x 20);
+    $dir .= pack("VVV", $entry->{"type"} == 1 ? 0 : $entry->{"start"},
+		 $entry->{"type"} == 1 ? 0 : length($entry->{"data"}), 0);
+  }
+  $dir .= pack("Z64vCCVVV", "", 0, 0, 0, 0xffffffff, 0xffffffff, 0xffffffff) . ("\0" x 48)
+    while (length($dir) % 512);
+  my $dirStart = $addChain->($dir);
+  # the bat and the mbat sectors
+  my $numBat = 0;
+  my $numMbat = 0;
+  while (1) {
+    my $total = @bat + $numBat + $numMbat;
+    my $needBat = int(($total + 127)/128);
+    my $needMbat = $needBat > 109 ? int(($needBat - 109 + 126)/127) : 0;
+    last if $needBat == $numBat && $needMbat == $numMbat;
+    ($numBat, $numMbat) = ($needBat, $needMbat);
+  }
+  my $batStart = @bat;
+  push @bat, (0xfffffffd) x $numBat;
+  my $mbatStart = @bat;
+  push @bat, (0xfffffffc) x $numMbat;
+  push @bat, (0xffffffff) x ($numBat*128 - @bat);
+  $sectors .= pack("V*", @bat);
+  my @batIds = ($batStart .. $batStart+$numBat-1);
+  my @mbat = @batIds > 109 ? @batIds[109 .. @batIds-1] : ();
+  for (my $i = 0; $i < $numMbat; ++$i) {
+    my @list = splice(@mbat, 0, 127);
+    push @list, (0xffffffff) x (127 - @list);
+    $sectors .= pack("V*", @list, $i+1 < $numMbat ? $mbatStart+$i+1 : 0xfffffffe);
+  }
+  my @headerBat = @batIds[0 .. ($numBat > 109 ? 108 : $numBat-1)];
+  push @headerBat, (0xffffffff) x (109 - @headerBat);
+  my $header = "\xd0\xcf\x11\xe0\xa1\xb1\x1a\xe1" . ("\0" x 16);
+  $header .= pack("vvvvv", 0x3e, 3, 0xfffe, 9, 6) . ("\0" x 10);
+  $header .= pack("VVVVVVVV", $numBat, $dirStart, 0, 4096, $sbatStart, $numSbat,
+		  $numMbat ? $mbatStart : 0xfffffffe, $numMbat);
+  $header .= pack("V*", @headerBat);
+
+  open(my $fh, ">", $file) or die "generate_corpus.pl: can not create \"$file\"\n";
+  binmode($fh);
+  print $fh $header, $sectors;
+  close($fh);
+}
+
+########################################
+# StarCalc
+########################################
+
+# returns a SC record: its 32 bits size followed by its content
+sub SCRecord { return U32(length($_[0])) . $_[0]; }
+# returns a SC multi record: a SC record followed by the table of the content sizes
+sub SCMultiRecord
+{
+  my ($content, @sizes) = @_;
+  return SCRecord($content) . U16(0x4200) . U32(4*@sizes) . pack("V*", @sizes);
+}
+
+# splits a list of SC sub records: [16 bits id][SC record][table if multi record]
+sub SplitSCRecords
+{
+  my ($data, $pos, $endPos, @multiIds) = @_;
+  my %isMulti = map { $_ => 1 } @multiIds;
+  my @records;
+  while ($pos + 6 <= $endPos) {
+    my ($id, $size) = (ReadU16($data, $pos), ReadU32($data, $pos+2));
+    my $end = $pos + 6 + $size;
+    $end += 6 + ReadU32($data, $end + 2) if $isMulti{$id} && $end + 6 <= $endPos && ReadU16($data, $end) == 0x4200;
+    last if $end > $endPos;
+    push @records, { "id" => $id, "data" => substr($data, $pos, $end - $pos) };
+    $pos = $end;
+  }
+  return @records;
+}
+
+# returns the list of cell attribute surrogates used in a table's columns
+sub GetSCTableSurrogates
+{
+  my ($table, $version) = @_;
+  my %surrogates;
+  foreach my $record (SplitSCRecords($table, 6, length($table), 0x4240)) {
+    next if $record->{"id"} != 0x4240;
+    my $columns = $record->{"data"};
+    my $size = ReadU32($columns, 2);
+    my $tablePos = 6 + $size;
+    my @offsets = unpack("V*", substr($columns, $tablePos + 6, ReadU32($columns, $tablePos + 2)));
+    my $pos = 6;
+    foreach my $offset (@offsets) {
+      ++$pos if $version >= 6;
+      last if $pos + $offset > $tablePos;
+      foreach my $column (SplitSCRecords($columns, $pos, $pos + $offset, 0x4250)) {
+	next if $column->{"id"} != 0x4252;
+	my $count = ReadU16($column->{"data"}, 6);
+	for (my $i = 0; $i < $count && 12 + 4*$i <= length($column->{"data"}); ++$i) {
+	  my $surrogate = ReadU16($column->{"data"}, 10 + 4*$i);
+	  $surrogates{$surrogate} = 1 if $surrogate < 0xfff0;
+	}
+      }
+      $pos += $offset;
+    }
+  }
+  return sort { $a <=> $b } keys %surrogates;
+}
+
+# returns a formula: =left+leftUp or =Sum(left0:leftN)
+sub SCFormula
+{
+  my ($col, $row, $tab, $version) = @_;
+  my $refCol = $col ? $col - 1 : $col + 1;
+  # the cell flags: relative column and row, absolute sheet
+  my $flags = 0x5;
+  my $cell = sub { return U16(0) . U8(3) . pack("vvv", $refCol, $_[0], $tab) . U8($flags); };
+  my @tokens;
+  if ($row == 0 || rand(2) < 1) {
+    @tokens = ($cell->($row), U16(21) . U8(0) . U8(0), $cell->($row ? $row - 1 : $row + 1));
+  }
+  else {
+    my $first = $row > 10 ? $row - 10 : 0;
+    @tokens = (U16(224) . U8(0) . U8(1), U16(7) . U8(0) . U8(0),
+	       U16(0) . U8(4) . pack("vvv", $refCol, $first, $tab) . U8($flags) . pack("vvv", $refCol, $row - 1, $tab) . U8($flags),
+	       U16(8) . U8(0) . U8(0));
+  }
+  return U8(0x40) . U8(0) . U16(scalar(@tokens)) . join("", @tokens);
+}
+
+# creates a synthetic column
+sub CreateSCColumn
+{
+  my ($col, $tab, $version, $maxRow, @surrogates) = @_;
+  my @kinds = ($opt{"values"}, $opt{"strings"}, $version >= 8 ? $opt{"formulas"} : 0);
+  my ($cells, $numCells) = ("", 0);
+  my @formulaSizes;
+  my @notes;
+  for (my $row = 0; $row < $opt{"rows"}; ++$row) {
+    my $kind = RandomChoice(@kinds);
+    my $flag = $version >= 7 ? U8(0) : "";
+    if ($kind == 0) {
+      $cells .= U16($row) . U8(1) . $flag . Double(int(rand(100000))/100);
+    }
+    elsif ($kind == 1) {
+      $cells .= U16($row) . U8(2) . $flag . String(join(" ", map { RandomWord() } (0..int(rand(4)))));
+    }
+    else {
+      my $content = U8(0) . U8(8) . U16(0) . Double(int(rand(100000))/100) . SCFormula($col, $row, $tab, $version);
+      $cells .= U16($row) . U8(3) . $content;
+      push @formulaSizes, length($content);
+    }
+    ++$numCells;
+    push @notes, U16($row) . String("note " . RandomWord()) . String("01.01.2000") . String(RandomWord())
+      if rand(100) < $opt{"notes"};
+  }
+  my $res = U16(0x4250) . SCMultiRecord(U16($numCells) . $cells, @formulaSizes);
+  $res .= U16(0x4251) . SCRecord(U16(scalar(@notes)) . join("", @notes)) if @notes;
+  # the attributes: some blocks of rows, the last one ending at maxRow
+  my @blocks;
+  for (my $row = 0; $row <= $maxRow;) {
+    my $last = $row + int(rand(50));
+    $last = $maxRow if $last > $maxRow || $row >= $opt{"rows"};
+    push @blocks, U16($last) . U16($surrogates[int(rand(@surrogates))]);
+    $row = $last + 1;
+  }
+  $res .= U16(0x4252) . SCRecord(U16(scalar(@blocks)) . join("", @blocks));
+  return $res;
+}
+
+# creates a synthetic table using the template's table for the other records
+sub CreateSCTable
+{
+  my ($template, $tab, $version, $maxRow, @surrogates) = @_;
+  my $content = "";
+  foreach my $record (SplitSCRecords($template, 6, length($template), 0x4240)) {
+    my $id = $record->{"id"};
+    if ($id == 0x4240) {
+      my ($columns, @sizes) = ("");
+      for (my $col = 0; $col < $opt{"columns"}; ++$col) {
+	my $column = CreateSCColumn($col, $tab, $version, $maxRow, @surrogates);
+	$columns .= U8($col) if $version >= 6;
+	$columns .= $column;
+	push @sizes, length($column);
+      }
+      $content .= U16(0x4240) . SCMultiRecord($columns, @sizes);
+    }
+    elsif ($id == 0x4242) {
+      # tabOptions: replace the table name
+      my $data = $record->{"data"};
+      my $nameLength = ReadU16($data, 6);
+      $content .= U16(0x4242) . SCRecord(String("Sheet" . ($tab + 1)) . substr($data, 8 + $nameLength));
+    }
+    else {
+      $content .= $record->{"data"};
+    }
+  }
+  return U16(0x4222) . SCRecord($content);
+}
+
+sub CreateCalcDocument
+{
+  my ($data) = @_;
+  my $id = ReadU16($data, 0);
+  die "generate_corpus.pl: the template StarCalcDocument is encrypted or is not supported\n"
+    if $id != 0x4220 && $id != 0x422d;
+  my @records = SplitSCRecords($data, 6, 6 + ReadU32($data, 2),
+			       0x4224, 0x4225, 0x4226, 0x4227, 0x422e, 0x422f, 0x4230, 0x4231, 0x4234, 0x4239);
+  my ($version, $maxRow) = (0, 8191);
+  my @tables;
+  foreach my $record (@records) {
+    my $content = $record->{"data"};
+    if ($record->{"id"} == 0x4221) {
+      # docFlags: vers, pageStyle, protected, passwd, language, autoCalc, visibleTab, vers, maxRow
+      my $pos = 6;
+      $version = ReadU16($content, $pos);
+      $pos += 2;
+      $pos += 2 + ReadU16($content, $pos);
+      ++$pos;
+      $pos += 2 + ReadU16($content, $pos);
+      $pos += 5;
+      ($version, $maxRow) = (ReadU16($content, $pos), ReadU16($content, $pos+2)) if $pos + 4 <= length($content);
+    }
+    push @tables, $content if $record->{"id"} == 0x4222;
+  }
+  die "generate_corpus.pl: can not find any table in the template\n" if !@tables;
+  die "generate_corpus.pl: the number of columns must be between 1 and 256\n"
+    if $opt{"columns"} < 1 || $opt{"columns"} > 256;
+  if ($opt{"rows"} > $maxRow + 1) {
+    print STDERR "generate_corpus.pl: the number of rows is limited to ", $maxRow + 1, "\n";
+    $opt{"rows"} = $maxRow + 1;
+  }
+  my @surrogates;
+  push @surrogates, GetSCTableSurrogates($_, $version) foreach (@tables);
+  my %seen;
+  @surrogates = grep { !$seen{$_}++ } @surrogates;
+  splice(@surrogates, $opt{"styles"} - 1) if $opt{"styles"} >= 1 && @surrogates > $opt{"styles"} - 1;
+  # add the default pattern
+  unshift @surrogates, 0xfffe;
+
+  my $content = "";
+  my $tablesAdded = 0;
+  foreach my $record (@records) {
+    if ($record->{"id"} != 0x4222) {
+      $content .= $record->{"data"};
+      next;
+    }
+    next if $tablesAdded;
+    $content .= CreateSCTable($tables[0], $_, $version, $maxRow, @surrogates) for (0 .. $opt{"sheets"} - 1);
+    $tablesAdded = 1;
+  }
+  return U16($id) . SCRecord($content) . substr($data, 6 + ReadU32($data, 2));
+}
+
+########################################
+# StarWriter
+########################################
+
+# returns the type, the begin and the end position of a SW record
+sub ReadSWRecord
+{
+  my ($data, $pos, $recordSizes) = @_;
+  return () if $pos + 4 > length($data);
+  my $val = ReadU32($data, $pos);
+  my ($type, $size) = ($val & 0xff, $val >> 8);
+  $size = $recordSizes->{$pos} if $size == 0xffffff && defined $recordSizes->{$pos};
+  return () if !$type || $size < 4 || $pos + $size > length($data);
+  return ($type, $pos, $pos + $size);
+}
+
+sub CreateWriterDocument
+{
+  my ($data) = @_;
+  die "generate_corpus.pl: the template StarWriterDocument is not supported\n"
+    if length($data) < 0x36 || substr($data, 0, 2) ne "SW" || substr($data, 3, 4) ne "HDR\0";
+  my $hSz = ReadU8($data, 7);
+  my ($docVersion, $fFlags) = (ReadU16($data, 8), ReadU16($data, 10));
+  my $recPos = ReadU32($data, 16);
+  die "generate_corpus.pl: the template StarWriterDocument is encrypted\n" if $fFlags & 8;
+  # the record sizes table: [%][flags][count][position, size]*
+  my %recordSizes;
+  my $recSizePos = 0;
+  if ($recPos && $docVersion >= 0x25 && $recPos + 9 <= length($data) && ReadU8($data, $recPos) == ord('%')) {
+    $recSizePos = $recPos + 5 + (ReadU8($data, $recPos + 4) & 0xf);
+    my $count = ReadU32($data, $recPos + 5);
+    for (my $i = 0; $i < $count; ++$i) {
+      my ($cPos, $size) = (ReadU32($data, $recSizePos + 8*$i), ReadU32($data, $recSizePos + 8*$i + 4));
+      $recordSizes{$cPos} = $size;
+    }
+  }
+  # find the main content
+  my ($nBegin, $nEnd);
+  for (my $pos = 8 + $hSz; $pos < length($data);) {
+    my ($type, $begin, $end) = ReadSWRecord($data, $pos, \%recordSizes);
+    last if !defined $type;
+    ($nBegin, $nEnd) = ($begin, $end) if $type == ord('N');
+    $pos = $end;
+  }
+  die "generate_corpus.pl: can not find the main content in the template\n" if !defined $nBegin;
+  # the main content: [N][flags][count][nodes]*
+  my ($countPos, $countSize, $nodePos) = ($nBegin + 4, 2, $nBegin + 4);
+  if ($docVersion >= 5) {
+    $nodePos = $nBegin + 5 + (ReadU8($data, $nBegin + 4) & 0xf);
+    ($countPos, $countSize) = $docVersion >= 0x201 ? ($nBegin + 5, 4) : ($nBegin + 7, 2);
+  }
+  else {
+    $nodePos += 2;
+  }
+  my $numNodes = $countSize == 4 ? ReadU32($data, $countPos) : ReadU16($data, $countPos);
+  my (@paragraphs, @graphics);
+  my $insertPos = $nodePos;
+  for (my ($pos, $i) = ($nodePos, 0); $pos < $nEnd && $i < $numNodes; ++$i) {
+    my ($type, $begin, $end) = ReadSWRecord($data, $pos, \%recordSizes);
+    last if !defined $type;
+    # only copy the nodes whose size is stored in the record
+    if (ReadU32($data, $begin) >> 8 != 0xffffff) {
+      push @paragraphs, substr($data, $begin, $end - $begin) if $type == ord('T');
+      push @graphics, substr($data, $begin, $end - $begin) if $type == ord('G');
+    }
+    $insertPos = $end if $type == ord('T') || $type == ord('G');
+    $pos = $end;
+  }
+  die "generate_corpus.pl: can not find any paragraph in the template's main content\n" if !@paragraphs;
+  if ($opt{"images"} && !@graphics) {
+    print STDERR "generate_corpus.pl: the template does not contain any graphic node, no image is added\n";
+  }
+  my $numParagraphs = grep { 1 } @paragraphs;
+  my $numGraphics = grep { 1 } @graphics;
+  my @kinds = ($opt{"paragraphs"} - $numParagraphs, @graphics ? $opt{"images"} - $numGraphics : 0);
+  $kinds[$_] = 0 foreach (grep { $kinds[$_] < 0 } (0, 1));
+  my $added = "";
+  my $numAdded = 0;
+  while ($kinds[0] + $kinds[1] > 0) {
+    my $kind = RandomChoice(@kinds);
+    my $list = $kind == 0 ? \@paragraphs : \@graphics;
+    $added .= $list->[$numAdded % @$list];
+    --$kinds[$kind];
+    ++$numAdded;
+  }
+  my $delta = length($added);
+  die "generate_corpus.pl: the main content is too big, reduce the number of paragraphs\n"
+    if $nEnd - $nBegin + $delta >= 0xffffff;
+  die "generate_corpus.pl: the number of nodes is too big\n" if $countSize == 2 && $numNodes + $numAdded > 0xffff;
+
+  # update the main content size and its number of nodes
+  my $res = substr($data, 0, $nBegin) . U32(ord('N') | (($nEnd - $nBegin + $delta) << 8));
+  $res .= substr($data, $nBegin + 4, $countPos - $nBegin - 4);
+  $res .= $countSize == 4 ? U32($numNodes + $numAdded) : U16($numNodes + $numAdded);
+  $res .= substr($data, $countPos + $countSize, $insertPos - $countPos - $countSize) . $added . substr($data, $insertPos);
+  if ($recSizePos) {
+    # update the record sizes table and its position
+    my $newRecPos = $recPos > $insertPos ? $recPos + $delta : $recPos;
+    substr($res, 16, 4) = U32($newRecPos);
+    my $count = ReadU32($res, $newRecPos + 5);
+    my $tablePos = $recSizePos - $recPos + $newRecPos;
+    for (my $i = 0; $i < $count; ++$i) {
+      my ($cPos, $size) = (ReadU32($res, $tablePos + 8*$i), ReadU32($res, $tablePos + 8*$i + 4));
+      if ($cPos >= $insertPos) {
+	$cPos += $delta;
+      }
+      elsif ($cPos + $size >= $insertPos) {
+	$size += $delta;
+      }
+      substr($res, $tablePos + 8*$i, 8) = U32($cPos) . U32($size);
+    }
+  }
+  return $res;
+}
+
+########################################
+# StarDraw
+########################################
+
+# returns the list of SDR headers in [pos, endPos[: {"magic", "begin", "end"}
+sub SplitSDRHeaders
+{
+  my ($data, $pos, $endPos, @magics) = @_;
+  my %accepted = map { $_ => 1 } @magics;
+  my @headers;
+  while ($pos + 4 <= $endPos) {
+    my $magic = substr($data, $pos, 4);
+    last if !$accepted{$magic};
+    my $end = $magic eq "DrXX" ? $pos + 4 : $pos + ReadU32($data, $pos + 6);
+    last if $end <= $pos || $end > $endPos;
+    push @headers, { "magic" => $magic, "begin" => $pos, "end" => $end };
+    $pos = $end;
+  }
+  return @headers;
+}
+
+# parses a page: returns the position of its data record and the list of objects
+sub ParseSdrPage
+{
+  my ($data, $begin, $end) = @_;
+  my $version = ReadU16($data, $begin + 4);
+  return () if $version == 0;
+  # an optional record, then the page data record
+  my $pos = $begin + 10;
+  $pos += ReadU32($data, $pos) if $pos + ReadU32($data, $pos) != $end;
+  my $dataPos = $pos;
+  $pos += 4;
+  $pos = $version >= 11 ? $pos + 4 + ReadU32($data, $pos + 4) : $pos + 26;
+  my $dataEnd = $dataPos + ReadU32($data, $dataPos);
+  my @layers = SplitSDRHeaders($data, $pos, $dataEnd, "DrLy", "DrLS", "DrMP", "DrML");
+  $pos = $layers[-1]->{"end"} if @layers;
+  my @objects = SplitSDRHeaders($data, $pos, $dataEnd, "DrOb");
+  $pos = $objects[-1]->{"end"} if @objects;
+  return () if substr($data, $pos, 4) ne "DrXX";
+  return ($dataPos, $pos, @objects);
+}
+
+# returns true if the object is a graphic object
+sub IsSdrGraphic
+{
+  my ($object) = @_;
+  return length($object) >= 16 && substr($object, 10, 4) eq "SVDr" && ReadU16($object, 14) == 22;
+}
+
+sub CreateDrawDocument
+{
+  my ($data) = @_;
+  die "generate_corpus.pl: the template StarDrawDocument is encrypted or is not supported\n"
+    if substr($data, 0, 4) ne "DrMd";
+  my $version = ReadU16($data, 4);
+  my $modelEnd = ReadU32($data, 6);
+  my $a1End = 10 + ReadU32($data, 10);
+  my $pos = 14;
+  $pos = 18 + ReadU32($data, 18) if $version >= 11 && substr($data, 14, 4) eq "JoeM";
+  my @children = SplitSDRHeaders($data, $pos, $a1End, "DrLy", "DrLS", "DrPg", "DrMP", "DrXX");
+  my @pages = grep { $_->{"magic"} eq "DrPg" } @children;
+  die "generate_corpus.pl: can not find any page in the template\n" if !@pages;
+  # StarDraw and StarImpress documents store a handout page and then a
+  # drawing page followed by its notes page
+  my $hasNotes = @pages >= 3 && (@pages % 2) == 1;
+
+  # look for the drawing objects and for the graphic objects
+  my ($firstPage, @objects, @graphics);
+  foreach my $child (@children) {
+    next if $child->{"magic"} ne "DrPg" && $child->{"magic"} ne "DrMP";
+    my ($dataPos, $objectsEnd, @list) = ParseSdrPage($data, $child->{"begin"}, $child->{"end"});
+    next if !defined $dataPos;
+    $_ = substr($data, $_->{"begin"}, $_->{"end"} - $_->{"begin"}) foreach (@list);
+    push @graphics, grep { IsSdrGraphic($_) } @list;
+    next if $child->{"magic"} ne "DrPg";
+    # ignore the handout and the notes pages
+    my ($id) = grep { $pages[$_]->{"begin"} == $child->{"begin"} } (0 .. @pages-1);
+    next if $hasNotes && ($id % 2) == 0;
+    push @objects, grep { !IsSdrGraphic($_) } @list;
+    $firstPage = { "child" => $child, "dataPos" => $dataPos, "objectsEnd" => $objectsEnd } if !defined $firstPage;
+  }
+  die "generate_corpus.pl: can not read the first page of the template\n" if !defined $firstPage;
+  @objects = @graphics if !@objects;
+  die "generate_corpus.pl: can not find any drawing object in the template\n" if !@objects;
+  if ($opt{"images"} && !@graphics) {
+    print STDERR "generate_corpus.pl: the template does not contain any graphic object, no image is added\n";
+  }
+
+  # fill the first page
+  my $images = @graphics ? $opt{"images"} : 0;
+  $images = $opt{"objects"} if $images > $opt{"objects"};
+  my @kinds = ($opt{"objects"} - $images, $images);
+  my $added = "";
+  my $numAdded = 0;
+  while ($kinds[0] + $kinds[1] > 0) {
+    my $kind = RandomChoice(@kinds);
+    my $list = $kind == 0 ? \@objects : \@graphics;
+    $added .= $list->[$numAdded % @$list];
+    --$kinds[$kind];
+    ++$numAdded;
+  }
+  my ($pageBegin, $pageEnd) = ($firstPage->{"child"}->{"begin"}, $firstPage->{"child"}->{"end"});
+  my ($dataPos, $objectsEnd) = ($firstPage->{"dataPos"}, $firstPage->{"objectsEnd"});
+  my $delta = length($added);
+  my $page = substr($data, $pageBegin, $objectsEnd - $pageBegin) . $added . substr($data, $objectsEnd, $pageEnd - $objectsEnd);
+  substr($page, 6, 4) = U32($pageEnd - $pageBegin + $delta);
+  substr($page, $dataPos - $pageBegin, 4) = U32(ReadU32($data, $dataPos) + $delta);
+
+  # replace the first page and add its copies (and the notes page copies) after the last page
+  my $numPages = $hasNotes ? (@pages - 1)/2 : @pages;
+  my $newPages = $opt{"pages"} > $numPages ? $opt{"pages"} - $numPages : 0;
+  my $copy = $page;
+  $copy .= substr($data, $pages[2]->{"begin"}, $pages[2]->{"end"} - $pages[2]->{"begin"}) if $hasNotes;
+  my $lastPageEnd = $pages[-1]->{"end"};
+  my $res = substr($data, 0, $pageBegin) . $page;
+  $res .= substr($data, $pageEnd, $lastPageEnd - $pageEnd) . ($copy x $newPages) . substr($data, $lastPageEnd);
+  $delta = length($res) - length($data);
+  die "generate_corpus.pl: the document is too big, reduce the number of pages or objects\n"
+    if $modelEnd + $delta > 0xffffffff;
+  substr($res, 6, 4) = U32($modelEnd + $delta);
+  substr($res, 10, 4) = U32($a1End - 10 + $delta);
+  return $res;
+}
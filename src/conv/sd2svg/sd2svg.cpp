@@ -81,6 +81,31 @@ static int printVersion()
   return 0;
 }
 
+//! converts a graphic or a presentation document, only converts the page page if page>0
+static STOFFDocument::Result convertPages(librevenge::RVNGInputStream &input, STOFFDocument::Kind kind, int page, librevenge::RVNGStringVector &vec)
+{
+  auto error=STOFFDocument::STOFF_R_OK;
+  try {
+    if (kind == STOFFDocument::STOFF_K_DRAW) {
+      librevenge::RVNGSVGDrawingGenerator listener(vec, "");
+      error = page>0 ? STOFFDocument::parsePages(&input, &listener, page, page) :
+              STOFFDocument::parse(&input, &listener);
+    }
+    else {
+      librevenge::RVNGSVGPresentationGenerator listener(vec);
+      error = page>0 ? STOFFDocument::parsePages(&input, &listener, page, page) :
+              STOFFDocument::parse(&input, &listener);
+    }
+  }
+  catch (STOFFDocument::Result const &err) {
+    error=err;
+  }
+  catch (...) {
+    error=STOFFDocument::STOFF_R_UNKNOWN_ERROR;
+  }
+  return error;
+}
+
 int main(int argc, char *argv[])
 {
   if (argc < 2)
@@ -131,31 +156,26 @@ int main(int argc, char *argv[])
     fprintf(stderr,"ERROR: Unsupported file format!\n");
     return 1;
   }
-  auto error=STOFFDocument::STOFF_R_OK;
+  if (kind != STOFFDocument::STOFF_K_DRAW && kind != STOFFDocument::STOFF_K_PRESENTATION) {
+    fprintf(stderr,"ERROR: not a graphic/presentation document!\n");
+    return 1;
+  }
   librevenge::RVNGStringVector vec;
-
-  try {
-    if (kind == STOFFDocument::STOFF_K_DRAW) {
-      librevenge::RVNGSVGDrawingGenerator listener(vec, "");
-      error = STOFFDocument::parse(&input, &listener);
-    }
-    else if (kind == STOFFDocument::STOFF_K_PRESENTATION) {
-      librevenge::RVNGSVGPresentationGenerator listener(vec);
-      error = STOFFDocument::parse(&input, &listener);
-    }
-    else {
-      fprintf(stderr,"ERROR: not a graphic/presentation document!\n");
+  // if we know the page, only parse this page
+  bool onlyOnePage=pageToConvert>0 && !printNumberOfPages;
+  auto error=convertPages(input, kind, onlyOnePage ? pageToConvert : 0, vec);
+  if (onlyOnePage && (error!=STOFFDocument::STOFF_R_OK || vec.empty() || vec[0].empty())) {
+    // the page probably does not exist, parse the whole document to retrieve its number of pages
+    onlyOnePage=false;
+    vec=librevenge::RVNGStringVector();
+    error=convertPages(input, kind, 0, vec);
+    if (error==STOFFDocument::STOFF_R_OK && unsigned(pageToConvert)>vec.size()) {
+      fprintf(stderr, "ERROR: can not find page %d, the document has %d page(s)!\n", pageToConvert, int(vec.size()));
       return 1;
     }
-    if (error==STOFFDocument::STOFF_R_OK && (vec.empty() || vec[0].empty()))
-      error = STOFFDocument::STOFF_R_UNKNOWN_ERROR;
-  }
-  catch (STOFFDocument::Result const &err) {
-    error=err;
-  }
-  catch (...) {
-    error=STOFFDocument::STOFF_R_UNKNOWN_ERROR;
   }
+  if (error==STOFFDocument::STOFF_R_OK && (vec.empty() || vec[0].empty()))
+    error = STOFFDocument::STOFF_R_UNKNOWN_ERROR;
   if (error == STOFFDocument::STOFF_R_FILE_ACCESS_ERROR)
     fprintf(stderr, "ERROR: File Exception!\n");
   else if (error == STOFFDocument::STOFF_R_PARSE_ERROR)
@@ -173,9 +193,9 @@ int main(int argc, char *argv[])
     return 0;
   }
 
-  unsigned page=pageToConvert>0 ? unsigned(pageToConvert-1) : 0;
+  unsigned page=pageToConvert>0 && !onlyOnePage ? unsigned(pageToConvert-1) : 0;
   if (page>=vec.size()) {
-    fprintf(stderr, "ERROR: can not find page %d!\n", int(page));
+    fprintf(stderr, "ERROR: can not find page %d, the document has %d page(s)!\n", int(page)+1, int(vec.size()));
     return 1;
   }
   if (!output) {
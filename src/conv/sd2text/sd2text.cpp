@@ -61,6 +61,8 @@ static int printUsage()
   printf("\t-h                show this help message\n");
   printf("\t-o OUTPUT         write ouput to OUTPUT\n");
   printf("\t-p PASSWORD       set password to open the file\n");
+  printf("\t-t                only retrieve the text: faster, but the layout, the\n");
+  printf("\t                  page styles and the embedded objects are ignored\n");
   printf("\t-v                show version information\n");
   printf("\n");
   printf("Report bugs to <https://github.com/fosnola/libstaroffice/issues>.\n");
@@ -81,10 +83,11 @@ int main(int argc, char *argv[])
   char const *output = nullptr;
   char const *password=nullptr;
   bool isInfo = false;
+  bool textOnly = false;
   bool printHelp=false;
   int ch;
 
-  while ((ch = getopt(argc, argv, "hio:p:v")) != -1) {
+  while ((ch = getopt(argc, argv, "hio:p:tv")) != -1) {
     switch (ch) {
     case 'i':
       isInfo=true;
@@ -95,6 +98,9 @@ int main(int argc, char *argv[])
     case 'p':
       password=optarg;
       break;
+    case 't':
+      textOnly=true;
+      break;
     case 'v':
       printVersion();
       return 0;
@@ -136,7 +142,8 @@ int main(int argc, char *argv[])
         return 1;
       }
       librevenge::RVNGTextDrawingGenerator documentGenerator(pages);
-      error=STOFFDocument::parse(&input, &documentGenerator, password);
+      error=textOnly ? STOFFDocument::parseTextOnly(&input, &documentGenerator, password) :
+            STOFFDocument::parse(&input, &documentGenerator, password);
       if (error == STOFFDocument::STOFF_R_OK && !pages.size()) {
         printf("ERROR: find no graphics!\n");
         return 1;
@@ -145,7 +152,8 @@ int main(int argc, char *argv[])
     }
     else if (kind == STOFFDocument::STOFF_K_SPREADSHEET || kind == STOFFDocument::STOFF_K_DATABASE) {
       librevenge::RVNGTextSpreadsheetGenerator documentGenerator(pages, isInfo);
-      error=STOFFDocument::parse(&input, &documentGenerator, password);
+      error=textOnly ? STOFFDocument::parseTextOnly(&input, &documentGenerator, password) :
+            STOFFDocument::parse(&input, &documentGenerator, password);
       if (error == STOFFDocument::STOFF_R_OK && !pages.size()) {
         printf("ERROR: find no sheets!\n");
         return 1;
@@ -158,7 +166,8 @@ int main(int argc, char *argv[])
         return 1;
       }
       librevenge::RVNGTextPresentationGenerator documentGenerator(pages);
-      error=STOFFDocument::parse(&input, &documentGenerator, password);
+      error=textOnly ? STOFFDocument::parseTextOnly(&input, &documentGenerator, password) :
+            STOFFDocument::parse(&input, &documentGenerator, password);
       if (error == STOFFDocument::STOFF_R_OK && !pages.size()) {
         printf("ERROR: find no slides!\n");
         return 1;
@@ -167,7 +176,8 @@ int main(int argc, char *argv[])
     }
     else {
       librevenge::RVNGTextTextGenerator documentGenerator(document, isInfo);
-      error=STOFFDocument::parse(&input, &documentGenerator, password);
+      error=textOnly ? STOFFDocument::parseTextOnly(&input, &documentGenerator, password) :
+            STOFFDocument::parse(&input, &documentGenerator, password);
     }
   }
   catch (STOFFDocument::Result const &err) {
@@ -152,11 +152,13 @@ bool SDAParser::createZones()
   }
   mainOle->m_parsed=true;
   StarObject mainObject(m_password, m_oleParser, mainOle);
+  mainObject.setTextOnly(getParserState()->m_textOnly);
   if (mainObject.getDocumentKind()!=STOFFDocument::STOFF_K_DRAW) {
     STOFF_DEBUG_MSG(("SDAParser::createZones: can not find the main graphic\n"));
     return false;
   }
   m_state->m_mainGraphic.reset(new StarObjectDraw(mainObject, false));
+  m_state->m_mainGraphic->setPageRange(getParserState()->m_pageRange);
   return m_state->m_mainGraphic->parse();
 }
 
@@ -169,6 +171,11 @@ void SDAParser::createDocument(librevenge::RVNGDrawingInterface *documentInterfa
 
   std::vector<STOFFPageSpan> pageList;
   if (!m_state->m_mainGraphic || !m_state->m_mainGraphic->updatePageSpans(pageList, m_state->m_numPages)) {
+    STOFFVec2i const &pageRange=getParserState()->m_pageRange;
+    if (pageRange[0]>0 || pageRange[1]>0) {
+      STOFF_DEBUG_MSG(("SDAParser::createDocument: can not find any page in the page range\n"));
+      throw libstoff::ParseException();
+    }
     STOFFPageSpan ps(getPageSpan());
     ps.m_pageSpan=1;
     pageList.push_back(ps);
@@ -190,6 +197,11 @@ void SDAParser::createDocument(librevenge::RVNGPresentationInterface *documentIn
 
   std::vector<STOFFPageSpan> pageList;
   if (!m_state->m_mainGraphic || !m_state->m_mainGraphic->updatePageSpans(pageList, m_state->m_numPages)) {
+    STOFFVec2i const &pageRange=getParserState()->m_pageRange;
+    if (pageRange[0]>0 || pageRange[1]>0) {
+      STOFF_DEBUG_MSG(("SDAParser::createDocument: can not find any page in the page range\n"));
+      throw libstoff::ParseException();
+    }
     STOFFPageSpan ps(getPageSpan());
     ps.m_pageSpan=1;
     pageList.push_back(ps);
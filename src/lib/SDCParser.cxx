@@ -125,6 +125,7 @@ bool SDCParser::createZones()
   }
   mainOle->m_parsed=true;
   StarObject mainObject(m_password, m_oleParser, mainOle);
+  mainObject.setTextOnly(getParserState()->m_textOnly);
   if (mainObject.getDocumentKind()!=STOFFDocument::STOFF_K_SPREADSHEET) {
     STOFF_DEBUG_MSG(("SDCParser::createZones: can not find the main spreadsheet\n"));
     return false;
@@ -126,6 +126,7 @@ bool SDWParser::createZones()
   }
   mainOle->m_parsed=true;
   StarObject mainObject(m_password, m_oleParser, mainOle);
+  mainObject.setTextOnly(getParserState()->m_textOnly);
   if (mainObject.getDocumentKind()!=STOFFDocument::STOFF_K_TEXT) {
     STOFF_DEBUG_MSG(("SDWParser::createZones: can not find the main graphic\n"));
     return false;
@@ -37,6 +37,7 @@
 #include <time.h>
 
 #include <cmath>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -407,6 +408,11 @@ std::ostream &operator<<(std::ostream &o, STOFFCellContent const &content)
     break;
   case STOFFCellContent::C_FORMULA:
     o << ",formula=";
+    if (content.m_formula.empty() && content.m_formulaTemplate) {
+      o << "[shared:" << content.m_formulaAnchor << "]";
+      for (const auto &l : *content.m_formulaTemplate)
+        o << l;
+    }
     for (const auto &l : content.m_formula)
       o << l;
     if (content.isValueSet()) o << "[" << content.m_value << "]";
@@ -420,6 +426,39 @@ std::ostream &operator<<(std::ostream &o, STOFFCellContent const &content)
   return o;
 }
 
+std::vector<STOFFCellContent::FormulaInstruction> STOFFCellContent::getFormulaTemplate(std::vector<FormulaInstruction> const &formula, STOFFVec2i const &anchor)
+{
+  std::vector<FormulaInstruction> res(formula);
+  for (auto &inst : res) {
+    if (inst.m_type!=FormulaInstruction::F_Cell && inst.m_type!=FormulaInstruction::F_CellList)
+      continue;
+    for (int i=0; i<(inst.m_type==FormulaInstruction::F_Cell ? 1 : 2); ++i) {
+      for (int c=0; c<2; ++c) {
+        if (inst.m_positionRelative[i][c])
+          inst.m_position[i][c]-=anchor[c];
+      }
+    }
+  }
+  return res;
+}
+
+void STOFFCellContent::expandFormula()
+{
+  if (!m_formulaTemplate || !m_formula.empty())
+    return;
+  m_formula=*m_formulaTemplate;
+  for (auto &inst : m_formula) {
+    if (inst.m_type!=FormulaInstruction::F_Cell && inst.m_type!=FormulaInstruction::F_CellList)
+      continue;
+    for (int i=0; i<(inst.m_type==FormulaInstruction::F_Cell ? 1 : 2); ++i) {
+      for (int c=0; c<2; ++c) {
+        if (inst.m_positionRelative[i][c])
+          inst.m_position[i][c]+=m_formulaAnchor[c];
+      }
+    }
+  }
+}
+
 // ---------- MWAWContentListener::FormulaInstruction ------------------
 librevenge::RVNGPropertyList STOFFCellContent::FormulaInstruction::getPropertyList() const
 {
@@ -483,6 +522,30 @@ librevenge::RVNGPropertyList STOFFCellContent::FormulaInstruction::getPropertyLi
   return pList;
 }
 
+int STOFFCellContent::FormulaInstruction::cmp(FormulaInstruction const &inst) const
+{
+  if (m_type<inst.m_type) return -1;
+  if (m_type>inst.m_type) return 1;
+  int diff=strcmp(m_content.cstr(), inst.m_content.cstr());
+  if (diff) return diff;
+  if (m_longValue<inst.m_longValue) return -1;
+  if (m_longValue>inst.m_longValue) return 1;
+  if (m_doubleValue<inst.m_doubleValue) return -1;
+  if (m_doubleValue>inst.m_doubleValue) return 1;
+  for (int i=0; i<2; ++i) {
+    diff=m_position[i].cmp(inst.m_position[i]);
+    if (diff) return diff;
+    diff=m_positionRelative[i].cmp(inst.m_positionRelative[i]);
+    if (diff) return diff;
+  }
+  diff=strcmp(m_sheet.cstr(), inst.m_sheet.cstr());
+  if (diff) return diff;
+  if (m_sheetId<inst.m_sheetId) return -1;
+  if (m_sheetId>inst.m_sheetId) return 1;
+  if (m_sheetIdRelative!=inst.m_sheetIdRelative) return m_sheetIdRelative ? 1 : -1;
+  return m_extra.compare(inst.m_extra);
+}
+
 std::ostream &operator<<(std::ostream &o, STOFFCellContent::FormulaInstruction const &inst)
 {
   if (inst.m_type==STOFFCellContent::FormulaInstruction::F_Double)
@@ -38,6 +38,7 @@
 #ifndef STOFF_CELL_H
 #  define STOFF_CELL_H
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -92,7 +93,8 @@ public:
     , m_format()
     , m_font()
     , m_cellStyle()
-    , m_numberingStyle() { }
+    , m_numberingStyle()
+    , m_numberingStyleName("") { }
 
   //! destructor
   virtual ~STOFFCell() {}
@@ -212,6 +214,16 @@ public:
   {
     m_numberingStyle=numberStyle;
   }
+  //! returns the numbering style name (if the style is already defined in the listener)
+  librevenge::RVNGString const &getNumberingStyleName() const
+  {
+    return m_numberingStyleName;
+  }
+  //! set the numbering style name (if the style is already defined in the listener)
+  void setNumberingStyleName(librevenge::RVNGString const &name)
+  {
+    m_numberingStyleName=name;
+  }
 protected:
   //! the cell row and column : 0,0 -> A1, 0,1 -> A2
   STOFFVec2i m_position;
@@ -228,6 +240,8 @@ protected:
   STOFFCellStyle m_cellStyle;
   //! the numbering style
   librevenge::RVNGPropertyList m_numberingStyle;
+  //! the numbering style name
+  librevenge::RVNGString m_numberingStyleName;
 };
 
 //! small class use to define a sheet cell content
@@ -250,6 +264,8 @@ public:
     librevenge::RVNGPropertyList getPropertyList() const;
     //! operator<<
     friend std::ostream &operator<<(std::ostream &o, FormulaInstruction const &inst);
+    //! a comparison function
+    int cmp(FormulaInstruction const &inst) const;
     //! the type
     Type m_type;
     //! the content ( if type == F_Operator or type = F_Function or type==F_Text)
@@ -275,7 +291,16 @@ public:
   /** the different types of cell's field */
   enum Type { C_NONE, C_TEXT, C_TEXT_BASIC, C_NUMBER, C_FORMULA, C_UNKNOWN };
   /// constructor
-  STOFFCellContent() : m_contentType(C_UNKNOWN), m_value(0.0), m_valueSet(false), m_text(), m_formula() { }
+  STOFFCellContent()
+    : m_contentType(C_UNKNOWN)
+    , m_value(0.0)
+    , m_valueSet(false)
+    , m_text()
+    , m_formula()
+    , m_formulaTemplate()
+    , m_formulaAnchor(0,0)
+  {
+  }
   /// destructor
   ~STOFFCellContent() {}
   //! operator<<
@@ -286,9 +311,29 @@ public:
   {
     if (m_contentType == C_NUMBER || m_contentType == C_TEXT) return false;
     if (m_contentType == C_TEXT_BASIC && !m_text.empty()) return false;
-    if (m_contentType == C_FORMULA && (m_formula.size() || isValueSet())) return false;
+    if (m_contentType == C_FORMULA && (hasFormula() || isValueSet())) return false;
     return true;
   }
+  //! returns true if the cell has a formula (expanded or shared)
+  bool hasFormula() const
+  {
+    return !m_formula.empty() || (m_formulaTemplate && !m_formulaTemplate->empty());
+  }
+  /** replaces the formula by a shared template anchored at anchor:
+      the relative cell positions of the template are stored as offset to anchor */
+  void setFormulaTemplate(std::shared_ptr<std::vector<FormulaInstruction> const> formulaTemplate, STOFFVec2i const &anchor)
+  {
+    std::vector<FormulaInstruction>().swap(m_formula);
+    m_formulaTemplate=formulaTemplate;
+    m_formulaAnchor=anchor;
+  }
+  /** creates the formula template corresponding to a formula anchored in anchor,
+      ie. retrieves the anchor position to the relative cell positions */
+  static std::vector<FormulaInstruction> getFormulaTemplate(std::vector<FormulaInstruction> const &formula, STOFFVec2i const &anchor);
+  /** expands the shared formula template (if set) in m_formula
+
+   \note m_formula can be cleared after sending the cell, the template is kept */
+  void expandFormula();
   //! sets the double value
   void setValue(double value)
   {
@@ -322,6 +367,10 @@ public:
   std::vector<uint32_t> m_text;
   //! the formula list of instruction
   std::vector<FormulaInstruction> m_formula;
+  //! the shared formula template (if set)
+  std::shared_ptr<std::vector<FormulaInstruction> const> m_formulaTemplate;
+  //! the position used to expand the formula template
+  STOFFVec2i m_formulaAnchor;
 };
 
 #endif
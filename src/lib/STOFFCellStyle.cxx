@@ -53,7 +53,7 @@ std::ostream &operator<<(std::ostream &o, STOFFCellStyle const &cellStyle)
 
 bool STOFFCellStyle::operator==(STOFFCellStyle const &cellStyle) const
 {
-  return m_propertyList.getPropString() == cellStyle.m_propertyList.getPropString() &&
+  return libstoff::comparePropertyList(m_propertyList, cellStyle.m_propertyList)==0 &&
          m_numberCellSpanned==cellStyle.m_numberCellSpanned && m_format==cellStyle.m_format;
 }
 
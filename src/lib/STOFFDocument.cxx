@@ -41,8 +41,13 @@
 #include "SDWParser.hxx"
 #include "SDXParser.hxx"
 
+#include "StarFileManager.hxx"
+#include "StarObject.hxx"
+#include "StarZone.hxx"
+
 #include "STOFFHeader.hxx"
 #include "STOFFGraphicDecoder.hxx"
+#include "STOFFOLEParser.hxx"
 #include "STOFFParser.hxx"
 #include "STOFFPropertyHandler.hxx"
 #include "STOFFSpreadsheetDecoder.hxx"
@@ -58,6 +63,10 @@ std::shared_ptr<STOFFTextParser> getTextParserFromHeader(STOFFInputStreamPtr &in
 std::shared_ptr<STOFFSpreadsheetParser> getSpreadsheetParserFromHeader(STOFFInputStreamPtr &input, STOFFHeader *header, char const *passwd);
 STOFFHeader *getHeader(STOFFInputStreamPtr &input, bool strict);
 bool checkHeader(STOFFInputStreamPtr &input, STOFFHeader &header, bool strict);
+STOFFDocument::Result parse(librevenge::RVNGInputStream *input, librevenge::RVNGDrawingInterface *documentInterface, char const *password, bool textOnly, STOFFVec2i const &pageRange=STOFFVec2i(0,0));
+STOFFDocument::Result parse(librevenge::RVNGInputStream *input, librevenge::RVNGPresentationInterface *documentInterface, char const *password, bool textOnly, STOFFVec2i const &pageRange=STOFFVec2i(0,0));
+STOFFDocument::Result parse(librevenge::RVNGInputStream *input, librevenge::RVNGSpreadsheetInterface *documentInterface, char const *password, bool textOnly);
+STOFFDocument::Result parse(librevenge::RVNGInputStream *input, librevenge::RVNGTextInterface *documentInterface, char const *password, bool textOnly);
 }
 
 STOFFDocument::Confidence STOFFDocument::isFileFormatSupported(librevenge::RVNGInputStream *input, Kind &kind)
@@ -90,152 +99,327 @@ catch (...)
   return STOFF_C_NONE;
 }
 
-STOFFDocument::Result STOFFDocument::parse(librevenge::RVNGInputStream *input, librevenge::RVNGDrawingInterface *documentInterface, char const *password)
+namespace STOFFDocumentInternal
+{
+STOFFDocument::Result parse(librevenge::RVNGInputStream *input, librevenge::RVNGDrawingInterface *documentInterface, char const *password, bool textOnly, STOFFVec2i const &pageRange)
 try
 {
   if (!input)
-    return STOFF_R_UNKNOWN_ERROR;
+    return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
 
   STOFFInputStreamPtr ip(new STOFFInputStream(input, false));
   std::shared_ptr<STOFFHeader> header(STOFFDocumentInternal::getHeader(ip, false));
 
-  if (!header.get()) return STOFF_R_UNKNOWN_ERROR;
+  if (!header.get()) return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
   auto parser=STOFFDocumentInternal::getGraphicParserFromHeader(ip, header.get(), password);
-  if (!parser) return STOFF_R_UNKNOWN_ERROR;
+  if (!parser) return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
+  parser->getParserState()->m_textOnly=textOnly;
+  parser->getParserState()->m_pageRange=pageRange;
   parser->parse(documentInterface);
-  return STOFF_R_OK;
+  return STOFFDocument::STOFF_R_OK;
 }
 catch (libstoff::FileException)
 {
   STOFF_DEBUG_MSG(("STOFFDocument::parse: File exception trapped\n"));
-  return STOFF_R_FILE_ACCESS_ERROR;
+  return STOFFDocument::STOFF_R_FILE_ACCESS_ERROR;
 }
 catch (libstoff::ParseException)
 {
   STOFF_DEBUG_MSG(("STOFFDocument::parse: Parse exception trapped\n"));
-  return STOFF_R_PARSE_ERROR;
+  return STOFFDocument::STOFF_R_PARSE_ERROR;
 }
 catch (libstoff::WrongPasswordException)
 {
   STOFF_DEBUG_MSG(("STOFFDocument::parse: Parse password trapped\n"));
-  return STOFF_R_PASSWORD_MISSMATCH_ERROR;
+  return STOFFDocument::STOFF_R_PASSWORD_MISSMATCH_ERROR;
 }
 catch (...)
 {
   //fixme: too generic
   STOFF_DEBUG_MSG(("STOFFDocument::parse: Unknown exception trapped\n"));
-  return STOFF_R_UNKNOWN_ERROR;
+  return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
+}
 }
 
-STOFFDocument::Result STOFFDocument::parse(librevenge::RVNGInputStream *input, librevenge::RVNGPresentationInterface *documentInterface, char const *password)
+STOFFDocument::Result STOFFDocument::parse(librevenge::RVNGInputStream *input, librevenge::RVNGDrawingInterface *documentInterface, char const *password)
+{
+  return STOFFDocumentInternal::parse(input, documentInterface, password, false);
+}
+
+STOFFDocument::Result STOFFDocument::parseTextOnly(librevenge::RVNGInputStream *input, librevenge::RVNGDrawingInterface *documentInterface, char const *password)
+{
+  return STOFFDocumentInternal::parse(input, documentInterface, password, true);
+}
+
+STOFFDocument::Result STOFFDocument::parsePages(librevenge::RVNGInputStream *input, librevenge::RVNGDrawingInterface *documentInterface, int firstPage, int lastPage, char const *password)
+{
+  return STOFFDocumentInternal::parse(input, documentInterface, password, false, STOFFVec2i(firstPage>1 ? firstPage : 1, lastPage>0 ? lastPage : 0));
+}
+
+namespace STOFFDocumentInternal
+{
+STOFFDocument::Result parse(librevenge::RVNGInputStream *input, librevenge::RVNGPresentationInterface *documentInterface, char const *password, bool textOnly, STOFFVec2i const &pageRange)
 try
 {
   if (!input)
-    return STOFF_R_UNKNOWN_ERROR;
+    return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
 
   STOFFInputStreamPtr ip(new STOFFInputStream(input, false));
   std::shared_ptr<STOFFHeader> header(STOFFDocumentInternal::getHeader(ip, false));
 
-  if (!header.get()) return STOFF_R_UNKNOWN_ERROR;
+  if (!header.get()) return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
   auto parser=STOFFDocumentInternal::getPresentationParserFromHeader(ip, header.get(), password);
-  if (!parser) return STOFF_R_UNKNOWN_ERROR;
+  if (!parser) return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
+  parser->getParserState()->m_textOnly=textOnly;
+  parser->getParserState()->m_pageRange=pageRange;
   parser->parse(documentInterface);
-  return STOFF_R_OK;
+  return STOFFDocument::STOFF_R_OK;
 }
 catch (libstoff::FileException)
 {
   STOFF_DEBUG_MSG(("STOFFDocument::parse: File exception trapped\n"));
-  return STOFF_R_FILE_ACCESS_ERROR;
+  return STOFFDocument::STOFF_R_FILE_ACCESS_ERROR;
 }
 catch (libstoff::ParseException)
 {
   STOFF_DEBUG_MSG(("STOFFDocument::parse: Parse exception trapped\n"));
-  return STOFF_R_PARSE_ERROR;
+  return STOFFDocument::STOFF_R_PARSE_ERROR;
 }
 catch (libstoff::WrongPasswordException)
 {
   STOFF_DEBUG_MSG(("STOFFDocument::parse: Parse password trapped\n"));
-  return STOFF_R_PASSWORD_MISSMATCH_ERROR;
+  return STOFFDocument::STOFF_R_PASSWORD_MISSMATCH_ERROR;
 }
 catch (...)
 {
   //fixme: too generic
   STOFF_DEBUG_MSG(("STOFFDocument::parse: Unknown exception trapped\n"));
-  return STOFF_R_UNKNOWN_ERROR;
+  return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
+}
 }
 
-STOFFDocument::Result STOFFDocument::parse(librevenge::RVNGInputStream *input, librevenge::RVNGSpreadsheetInterface *documentInterface, char const *password)
+STOFFDocument::Result STOFFDocument::parse(librevenge::RVNGInputStream *input, librevenge::RVNGPresentationInterface *documentInterface, char const *password)
+{
+  return STOFFDocumentInternal::parse(input, documentInterface, password, false);
+}
+
+STOFFDocument::Result STOFFDocument::parseTextOnly(librevenge::RVNGInputStream *input, librevenge::RVNGPresentationInterface *documentInterface, char const *password)
+{
+  return STOFFDocumentInternal::parse(input, documentInterface, password, true);
+}
+
+STOFFDocument::Result STOFFDocument::parsePages(librevenge::RVNGInputStream *input, librevenge::RVNGPresentationInterface *documentInterface, int firstPage, int lastPage, char const *password)
+{
+  return STOFFDocumentInternal::parse(input, documentInterface, password, false, STOFFVec2i(firstPage>1 ? firstPage : 1, lastPage>0 ? lastPage : 0));
+}
+
+namespace STOFFDocumentInternal
+{
+STOFFDocument::Result parse(librevenge::RVNGInputStream *input, librevenge::RVNGSpreadsheetInterface *documentInterface, char const *password, bool textOnly)
 try
 {
   if (!input)
-    return STOFF_R_UNKNOWN_ERROR;
+    return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
 
   STOFFInputStreamPtr ip(new STOFFInputStream(input, false));
   std::shared_ptr<STOFFHeader> header(STOFFDocumentInternal::getHeader(ip, false));
 
-  if (!header.get()) return STOFF_R_UNKNOWN_ERROR;
+  if (!header.get()) return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
   auto parser=STOFFDocumentInternal::getSpreadsheetParserFromHeader(ip, header.get(), password);
-  if (!parser) return STOFF_R_UNKNOWN_ERROR;
+  if (!parser) return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
+  parser->getParserState()->m_textOnly=textOnly;
   parser->parse(documentInterface);
-  return STOFF_R_OK;
+  return STOFFDocument::STOFF_R_OK;
 }
 catch (libstoff::FileException)
 {
   STOFF_DEBUG_MSG(("STOFFDocument::parse: File exception trapped\n"));
-  return STOFF_R_FILE_ACCESS_ERROR;
+  return STOFFDocument::STOFF_R_FILE_ACCESS_ERROR;
 }
 catch (libstoff::ParseException)
 {
   STOFF_DEBUG_MSG(("STOFFDocument::parse: Parse exception trapped\n"));
-  return STOFF_R_PARSE_ERROR;
+  return STOFFDocument::STOFF_R_PARSE_ERROR;
 }
 catch (libstoff::WrongPasswordException)
 {
   STOFF_DEBUG_MSG(("STOFFDocument::parse: Parse password trapped\n"));
-  return STOFF_R_PASSWORD_MISSMATCH_ERROR;
+  return STOFFDocument::STOFF_R_PASSWORD_MISSMATCH_ERROR;
 }
 catch (...)
 {
   //fixme: too generic
   STOFF_DEBUG_MSG(("STOFFDocument::parse: Unknown exception trapped\n"));
-  return STOFF_R_UNKNOWN_ERROR;
+  return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
+}
 }
 
-STOFFDocument::Result STOFFDocument::parse(librevenge::RVNGInputStream *input, librevenge::RVNGTextInterface *documentInterface, char const *password)
+STOFFDocument::Result STOFFDocument::parse(librevenge::RVNGInputStream *input, librevenge::RVNGSpreadsheetInterface *documentInterface, char const *password)
+{
+  return STOFFDocumentInternal::parse(input, documentInterface, password, false);
+}
+
+STOFFDocument::Result STOFFDocument::parseTextOnly(librevenge::RVNGInputStream *input, librevenge::RVNGSpreadsheetInterface *documentInterface, char const *password)
+{
+  return STOFFDocumentInternal::parse(input, documentInterface, password, true);
+}
+
+namespace STOFFDocumentInternal
+{
+STOFFDocument::Result parse(librevenge::RVNGInputStream *input, librevenge::RVNGTextInterface *documentInterface, char const *password, bool textOnly)
 try
 {
   if (!input)
-    return STOFF_R_UNKNOWN_ERROR;
+    return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
 
   STOFFInputStreamPtr ip(new STOFFInputStream(input, false));
   std::shared_ptr<STOFFHeader> header(STOFFDocumentInternal::getHeader(ip, false));
 
-  if (!header.get()) return STOFF_R_UNKNOWN_ERROR;
+  if (!header.get()) return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
   auto parser=STOFFDocumentInternal::getTextParserFromHeader(ip, header.get(), password);
-  if (!parser) return STOFF_R_UNKNOWN_ERROR;
+  if (!parser) return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
+  parser->getParserState()->m_textOnly=textOnly;
   parser->parse(documentInterface);
 
-  return STOFF_R_OK;
+  return STOFFDocument::STOFF_R_OK;
 }
 catch (libstoff::FileException)
 {
   STOFF_DEBUG_MSG(("STOFFDocument::parse: File exception trapped\n"));
-  return STOFF_R_FILE_ACCESS_ERROR;
+  return STOFFDocument::STOFF_R_FILE_ACCESS_ERROR;
 }
 catch (libstoff::ParseException)
 {
   STOFF_DEBUG_MSG(("STOFFDocument::parse: Parse exception trapped\n"));
-  return STOFF_R_PARSE_ERROR;
+  return STOFFDocument::STOFF_R_PARSE_ERROR;
 }
 catch (libstoff::WrongPasswordException)
 {
   STOFF_DEBUG_MSG(("STOFFDocument::parse: Parse password trapped\n"));
-  return STOFF_R_PASSWORD_MISSMATCH_ERROR;
+  return STOFFDocument::STOFF_R_PASSWORD_MISSMATCH_ERROR;
 }
 catch (...)
 {
   //fixme: too generic
   STOFF_DEBUG_MSG(("STOFFDocument::parse: Unknown exception trapped\n"));
+  return STOFFDocument::STOFF_R_UNKNOWN_ERROR;
+}
+}
+
+STOFFDocument::Result STOFFDocument::parse(librevenge::RVNGInputStream *input, librevenge::RVNGTextInterface *documentInterface, char const *password)
+{
+  return STOFFDocumentInternal::parse(input, documentInterface, password, false);
+}
+
+STOFFDocument::Result STOFFDocument::parseTextOnly(librevenge::RVNGInputStream *input, librevenge::RVNGTextInterface *documentInterface, char const *password)
+{
+  return STOFFDocumentInternal::parse(input, documentInterface, password, true);
+}
+
+STOFFDocument::Result STOFFDocument::parseMetaData(librevenge::RVNGInputStream *input, librevenge::RVNGPropertyList &metaData)
+try
+{
+  metaData.clear();
+  if (!input)
+    return STOFF_R_UNKNOWN_ERROR;
+
+  STOFFInputStreamPtr ip(new STOFFInputStream(input, false));
+  if (!ip->isStructured()) {
+    STOFF_DEBUG_MSG(("STOFFDocument::parseMetaData: the input is not an OLE file\n"));
+    return STOFF_R_OLE_ERROR;
+  }
+  // the meta data of the SfxDocumentInfo zone, without creating the document's parser
+  auto docInfo=ip->getSubStreamByName("SfxDocumentInfo");
+  if (docInfo) {
+    docInfo->setReadInverted(true);
+    std::shared_ptr<STOFFOLEParser> oleParser;
+    std::shared_ptr<STOFFOLEParser::OleDirectory> directory;
+    StarObject object(nullptr, oleParser, directory);
+    object.readSfxDocumentInformation(docInfo, "SfxDocumentInfo");
+    metaData=object.getMetaData();
+  }
+  // then complete them with the OLE summary
+  for (unsigned i=0; i<ip->subStreamCount(); ++i) {
+    auto name=ip->subStreamName(i);
+    auto base=name;
+    if (!base.empty() && base[0]>0 && base[0]<' ') base=base.substr(1); // "\005SummaryInformation"
+    if (base!="SummaryInformation") continue;
+    auto summary=ip->getSubStreamByName(name);
+    if (!summary) continue;
+    summary->setReadInverted(true);
+    librevenge::RVNGPropertyList summaryData;
+    libstoff::DebugFile ascii(summary);
+    ascii.open(name);
+    STOFFOLEParser::readSummaryInformation(summary, "SummaryInformation", summaryData, ascii);
+    librevenge::RVNGPropertyList::Iter it(summaryData);
+    for (it.rewind(); it.next();) {
+      if (!metaData[it.key()])
+        metaData.insert(it.key(), it()->clone());
+    }
+    break;
+  }
+  return STOFF_R_OK;
+}
+catch (libstoff::FileException)
+{
+  STOFF_DEBUG_MSG(("STOFFDocument::parseMetaData: File exception trapped\n"));
+  return STOFF_R_FILE_ACCESS_ERROR;
+}
+catch (...)
+{
+  STOFF_DEBUG_MSG(("STOFFDocument::parseMetaData: Unknown exception trapped\n"));
+  return STOFF_R_UNKNOWN_ERROR;
+}
+
+STOFFDocument::Result STOFFDocument::parseThumbnail(librevenge::RVNGInputStream *input, librevenge::RVNGBinaryData &picture, librevenge::RVNGString &mimeType)
+try
+{
+  picture.clear();
+  mimeType.clear();
+  if (!input)
+    return STOFF_R_UNKNOWN_ERROR;
+
+  STOFFInputStreamPtr ip(new STOFFInputStream(input, false));
+  if (!ip->isStructured()) {
+    STOFF_DEBUG_MSG(("STOFFDocument::parseThumbnail: the input is not an OLE file\n"));
+    return STOFF_R_OLE_ERROR;
+  }
+  auto preview=ip->getSubStreamByName("SfxPreview");
+  if (!preview) {
+    STOFF_DEBUG_MSG(("STOFFDocument::parseThumbnail: can not find the preview\n"));
+    return STOFF_R_PARSE_ERROR;
+  }
+  preview->setReadInverted(true);
+  // the preview is not encrypted
+  StarZone zone(preview, "SfxPreview", "SfxPreview", nullptr);
+  zone.ascii().open("SfxPreview");
+  std::string type;
+  if (!StarFileManager::readSVGDI(zone, &picture, &type)) {
+    STOFF_DEBUG_MSG(("STOFFDocument::parseThumbnail: can not read the preview\n"));
+    picture.clear();
+    return STOFF_R_PARSE_ERROR;
+  }
+  if (picture.empty()) {
+    // the preview only contains some vector drawing: returns the metafile
+    preview->seek(0, librevenge::RVNG_SEEK_SET);
+    if (!preview->readEndDataBlock(picture) || picture.empty()) {
+      STOFF_DEBUG_MSG(("STOFFDocument::parseThumbnail: can not retrieve the preview metafile\n"));
+      picture.clear();
+      return STOFF_R_PARSE_ERROR;
+    }
+    type="image/svg";
+  }
+  mimeType=type.c_str();
+  return STOFF_R_OK;
+}
+catch (libstoff::FileException)
+{
+  STOFF_DEBUG_MSG(("STOFFDocument::parseThumbnail: File exception trapped\n"));
+  return STOFF_R_FILE_ACCESS_ERROR;
+}
+catch (...)
+{
+  STOFF_DEBUG_MSG(("STOFFDocument::parseThumbnail: Unknown exception trapped\n"));
   return STOFF_R_UNKNOWN_ERROR;
 }
 
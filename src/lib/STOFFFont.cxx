@@ -57,10 +57,8 @@ std::ostream &operator<<(std::ostream &o, STOFFFont const &font)
 
 int STOFFFont::cmp(STOFFFont const &font) const
 {
-  if (m_propertyList.getPropString() < font.m_propertyList.getPropString())
-    return -1;
-  if (m_propertyList.getPropString() > font.m_propertyList.getPropString())
-    return 1;
+  int diff=libstoff::comparePropertyList(m_propertyList, font.m_propertyList);
+  if (diff) return diff;
   if (m_shadowColor < font.m_shadowColor)
     return -1;
   if (m_shadowColor > font.m_shadowColor)
@@ -49,7 +49,7 @@ std::ostream &operator<<(std::ostream &o, STOFFFrameStyle const &frameStyle)
 
 bool STOFFFrameStyle::operator==(STOFFFrameStyle const &frameStyle) const
 {
-  return m_propertyList.getPropString() == frameStyle.m_propertyList.getPropString() &&
+  return libstoff::comparePropertyList(m_propertyList, frameStyle.m_propertyList)==0 &&
          m_position==frameStyle.m_position && m_anchorIndex == frameStyle.m_anchorIndex;
 }
 
@@ -35,8 +35,8 @@
 
 #include <cstring>
 #include <iomanip>
-#include <set>
 #include <sstream>
+#include <unordered_set>
 
 #include <librevenge/librevenge.h>
 
@@ -109,11 +109,11 @@ struct GraphicState {
   //! the list of actual subdocument
   std::vector<STOFFSubDocumentPtr> m_subDocuments;
   //! the set of defined font style
-  std::set<librevenge::RVNGString> m_definedFontStyleSet;
+  std::unordered_set<librevenge::RVNGString, libstoff::RVNGStringHash> m_definedFontStyleSet;
   //! the set of defined graphic style
-  std::set<librevenge::RVNGString> m_definedGraphicStyleSet;
+  std::unordered_set<librevenge::RVNGString, libstoff::RVNGStringHash> m_definedGraphicStyleSet;
   //! the set of defined paragraph style
-  std::set<librevenge::RVNGString> m_definedParagraphStyleSet;
+  std::unordered_set<librevenge::RVNGString, libstoff::RVNGStringHash> m_definedParagraphStyleSet;
   //! am empty section
   STOFFSection m_section;
 };
@@ -133,7 +133,7 @@ struct State {
   //! the origin position
   STOFFVec2f m_origin;
   //! a buffer to stored the text
-  librevenge::RVNGString m_textBuffer;
+  STOFFListenerTextBuffer m_textBuffer;
 
   //! the font
   STOFFFont m_font;
@@ -182,7 +182,7 @@ private:
 
 State::State()
   : m_origin(0,0)
-  , m_textBuffer("")
+  , m_textBuffer()
   , m_font()/* default time 12 */
   , m_paragraph()
   , m_list()
@@ -318,7 +318,18 @@ void STOFFGraphicListener::insertUnicode(uint32_t val)
     return;
   }
   if (!m_ps->m_isSpanOpened) _openSpan();
-  libstoff::appendUnicode(val, m_ps->m_textBuffer);
+  m_ps->m_textBuffer.appendUnicode(val);
+}
+
+void STOFFGraphicListener::insertUnicodeRun(uint32_t const *characters, size_t numCharacters)
+{
+  if (!m_ps->isInTextZone()) {
+    STOFF_DEBUG_MSG(("STOFFGraphicListener::insertUnicodeRun: called outside a text zone\n"));
+    return;
+  }
+  if (!numCharacters) return;
+  if (!m_ps->m_isSpanOpened) _openSpan();
+  m_ps->m_textBuffer.appendUnicode(characters, numCharacters);
 }
 
 void STOFFGraphicListener::insertUnicodeString(librevenge::RVNGString const &str)
@@ -915,38 +926,13 @@ void STOFFGraphicListener::_closeSpan()
 ///////////////////
 void STOFFGraphicListener::_flushText()
 {
-  if (m_ps->m_textBuffer.len() == 0) return;
+  if (m_ps->m_textBuffer.empty()) return;
 
   // when some many ' ' follows each other, call insertSpace
-  librevenge::RVNGString tmpText("");
-  int numConsecutiveSpaces = 0;
-  librevenge::RVNGString::Iter i(m_ps->m_textBuffer);
-  for (i.rewind(); i.next();) {
-    if (*(i()) == 0x20) // this test is compatible with unicode format
-      numConsecutiveSpaces++;
-    else
-      numConsecutiveSpaces = 0;
-
-    if (numConsecutiveSpaces > 1) {
-      if (tmpText.len() > 0) {
-        if (m_drawingInterface)
-          m_drawingInterface->insertText(tmpText);
-        else
-          m_presentationInterface->insertText(tmpText);
-        tmpText.clear();
-      }
-      if (m_drawingInterface)
-        m_drawingInterface->insertSpace();
-      else
-        m_presentationInterface->insertSpace();
-    }
-    else
-      tmpText.append(i());
-  }
   if (m_drawingInterface)
-    m_drawingInterface->insertText(tmpText);
+    m_ps->m_textBuffer.send(*m_drawingInterface);
   else
-    m_presentationInterface->insertText(tmpText);
+    m_ps->m_textBuffer.send(*m_presentationInterface);
   m_ps->m_textBuffer.clear();
 }
 
@@ -59,7 +59,7 @@ std::ostream &operator<<(std::ostream &o, STOFFGraphicStyle const &graphicStyle)
 
 bool STOFFGraphicStyle::operator==(STOFFGraphicStyle const &graphicStyle) const
 {
-  return m_propertyList.getPropString() == graphicStyle.m_propertyList.getPropString() && m_hasBackground==graphicStyle.m_hasBackground;
+  return libstoff::comparePropertyList(m_propertyList, graphicStyle.m_propertyList)==0 && m_hasBackground==graphicStyle.m_hasBackground;
 }
 
 void STOFFGraphicStyle::addTo(librevenge::RVNGPropertyList &pList) const
@@ -447,18 +447,27 @@ bool STOFFInputStream::readDoubleReverted8(double &res, bool &isNotANumber)
   long pos=tell();
   if (pos+8 > m_streamSize) return false;
 
+  unsigned long numBytesRead;
+  uint8_t const *buffer=m_stream->read(8, numBytesRead);
+  if (!buffer || numBytesRead!=8) {
+    isNotANumber=false;
+    res=0;
+    return false;
+  }
+  return decodeDoubleReverted8(buffer, res, isNotANumber);
+}
+
+bool STOFFInputStream::decodeDoubleReverted8(uint8_t const *buffer, double &res, bool &isNotANumber)
+{
   isNotANumber=false;
   res=0;
-  int bytes[6];
-  for (int &byte : bytes) byte=int(readULong(1));
-
-  auto val=int(readULong(1));
-  auto mantExp=int(readULong(1));
+  auto val=int(buffer[6]);
+  auto mantExp=int(buffer[7]);
   int exp=(mantExp<<4)+(val>>4);
   double mantisse=double(val&0xF)/16.;
   double factor=1./16./256.;
   for (int j = 0; j < 6; ++j, factor/=256)
-    mantisse+=double(bytes[5-j])*factor;
+    mantisse+=double(buffer[5-j])*factor;
   int sign = 1;
   if (exp & 0x800) {
     exp &= 0x7ff;
@@ -186,6 +186,8 @@ public:
   bool readDouble8(double &res, bool &isNotANumber);
   //! try to read a double of size 8: 6.5 bytes mantisse, 1.5 bytes exponent
   bool readDoubleReverted8(double &res, bool &isNotANumber);
+  //! try to decode a double of size 8 stored in buffer: 6.5 bytes mantisse, 1.5 bytes exponent
+  static bool decodeDoubleReverted8(uint8_t const *buffer, double &res, bool &isNotANumber);
   //! try to read a double of size 10: 2 bytes exponent, 8 bytes mantisse
   bool readDouble10(double &res, bool &isNotANumber);
   /**! reads numbytes data, WITHOUT using any endian or section consideration
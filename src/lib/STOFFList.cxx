@@ -68,8 +68,7 @@ int STOFFListLevel::cmp(STOFFListLevel const &levl) const
 {
   int diff = int(m_type)-int(levl.m_type);
   if (diff) return diff;
-  diff = strcmp(m_propertyList.getPropString().cstr(),
-                levl.m_propertyList.getPropString().cstr());
+  diff = libstoff::comparePropertyList(m_propertyList, levl.m_propertyList);
   if (diff) return diff;
   if (m_font) {
     if (!levl.m_font) return -1;
@@ -38,6 +38,53 @@
 
 #include "STOFFList.hxx"
 
+////////////////////////////////////////////////////////////
+// STOFFListenerTextBuffer
+////////////////////////////////////////////////////////////
+void STOFFListenerTextBuffer::append(librevenge::RVNGString const &str)
+{
+  char const *ptr=str.cstr();
+  if (!ptr) return;
+  while (*ptr)
+    append(*(ptr++));
+}
+
+void STOFFListenerTextBuffer::appendUnicode(uint32_t val)
+{
+  if (val<0x80) {
+    append(char(val));
+    return;
+  }
+  libstoff::appendUnicode(val, m_text);
+  m_lastIsSpace=false;
+}
+
+void STOFFListenerTextBuffer::appendUnicode(uint32_t const *characters, size_t numCharacters)
+{
+  if (!characters) return;
+  size_t pos=0;
+  while (pos<numCharacters) {
+    // look for the next run of ascii characters which are not spaces
+    size_t end=pos;
+    while (end<numCharacters && characters[end]>0x20 && characters[end]<0x80)
+      ++end;
+    if (end>pos) {
+      size_t const oldSize=m_text.size();
+      m_text.resize(oldSize+(end-pos));
+      char *out=&m_text[oldSize];
+      for (size_t i=pos; i<end; ++i)
+        *(out++)=char(characters[i]);
+      m_lastIsSpace=false;
+      pos=end;
+    }
+    if (pos<numCharacters)
+      appendUnicode(characters[pos++]);
+  }
+}
+
+////////////////////////////////////////////////////////////
+// STOFFListener
+////////////////////////////////////////////////////////////
 STOFFListener::STOFFListener(STOFFListManagerPtr &listManager)
   : m_listManager(listManager)
 {
@@ -34,6 +34,7 @@
 #ifndef STOFF_LISTENER_H
 #define STOFF_LISTENER_H
 
+#include <string>
 #include <vector>
 
 #include <librevenge/librevenge.h>
@@ -46,6 +47,81 @@
 class STOFFCell;
 class STOFFTable;
 
+/** \brief a class used to store the text of a span in UTF-8
+ *
+ * The position of the consecutive spaces, which must be sent with
+ * insertSpace, are found when the characters are added, so the text
+ * can be sent without being parsed again.
+ */
+class STOFFListenerTextBuffer
+{
+public:
+  //! constructor
+  STOFFListenerTextBuffer()
+    : m_text()
+    , m_spacePositions()
+    , m_lastIsSpace(false)
+  {
+  }
+  //! returns true if the buffer is empty
+  bool empty() const
+  {
+    return m_text.empty() && m_spacePositions.empty();
+  }
+  //! resets the buffer
+  void clear()
+  {
+    m_text.clear();
+    m_spacePositions.clear();
+    m_lastIsSpace=false;
+  }
+  //! adds a character (or a byte of an UTF-8 character)
+  void append(char c)
+  {
+    if (c==' ') {
+      if (m_lastIsSpace) {
+        m_spacePositions.push_back(m_text.size());
+        return;
+      }
+      m_lastIsSpace=true;
+    }
+    else
+      m_lastIsSpace=false;
+    m_text.push_back(c);
+  }
+  //! adds an UTF-8 string
+  void append(librevenge::RVNGString const &str);
+  //! adds an unicode character
+  void appendUnicode(uint32_t val);
+  //! adds a list of unicode characters
+  void appendUnicode(uint32_t const *characters, size_t numCharacters);
+  /** sends the text to an interface: a RVNGTextInterface, a
+      RVNGDrawingInterface or a RVNGPresentationInterface */
+  template <class Interface> void send(Interface &interface) const
+  {
+    if (m_spacePositions.empty()) {
+      interface.insertText(librevenge::RVNGString(m_text.c_str()));
+      return;
+    }
+    size_t pos=0;
+    for (auto spacePos : m_spacePositions) {
+      if (spacePos>pos) {
+        interface.insertText(librevenge::RVNGString(m_text.substr(pos, spacePos-pos).c_str()));
+        pos=spacePos;
+      }
+      interface.insertSpace();
+    }
+    interface.insertText(librevenge::RVNGString(m_text.c_str()+pos));
+  }
+protected:
+  //! the text without the spaces which must be sent with insertSpace
+  std::string m_text;
+  //! the positions in m_text where insertSpace must be called
+  std::vector<size_t> m_spacePositions;
+  //! a flag to know if the last character is a space
+  bool m_lastIsSpace;
+};
+
 /** This class contains a virtual interface to all listener */
 class STOFFListener
 {
@@ -110,16 +186,26 @@ public:
   /** adds an unicode character.
    *  By convention if \a character=0xfffd(undef), no character is added */
   virtual void insertUnicode(uint32_t character)=0;
+  /** adds a list of unicode characters which does not contain any
+      control character nor the undef character */
+  virtual void insertUnicodeRun(uint32_t const *characters, size_t numCharacters)=0;
   /** try to insert a list of unicode character */
   void insertUnicodeList(std::vector<uint32_t> const &list)
   {
     if (list.empty() || !canWriteText())
       return;
-    for (unsigned int i : list) {
-      if (i==0x9) insertTab();
-      else if (i==0xa || i==0xc) insertEOL(); // checkme: use softBreak ?
-      else insertUnicode(i);
+    size_t const numChars=list.size();
+    size_t first=0;
+    for (size_t i=0; i<numChars; ++i) {
+      uint32_t c=list[i];
+      if (c>=0x20 && c!=0xfffd) continue;
+      if (i>first) insertUnicodeRun(&list[first], i-first);
+      first=i+1;
+      if (c==0x9) insertTab();
+      else if (c==0xa || c==0xc) insertEOL(); // checkme: use softBreak ?
+      else insertUnicode(c);
     }
+    if (numChars>first) insertUnicodeRun(&list[first], numChars-first);
   }
   //! adds a unicode string
   virtual void insertUnicodeString(librevenge::RVNGString const &str)=0;
@@ -230,6 +230,26 @@ void State::initCLSMap()
   //m_mapCls[0x000456EE]= "StarMath2"; // "StarMath 2.0"
 }
 
+//! converts a FILETIME (number of 100ns since 1601/01/01) in a date time string
+static bool convertFileTime(uint64_t fileTime, std::string &dateTime)
+{
+  auto seconds=fileTime/10000000;
+  // the number of days since 0000/03/01, then the civil date
+  auto days=long(seconds/86400)+584694;
+  seconds%=86400;
+  long era=days/146097;
+  long dayOfEra=days-era*146097;
+  long yearOfEra=(dayOfEra-dayOfEra/1460+dayOfEra/36524-dayOfEra/146096)/365;
+  long dayOfYear=dayOfEra-(365*yearOfEra+yearOfEra/4-yearOfEra/100);
+  long mp=(5*dayOfYear+2)/153;
+  long day=dayOfYear-(153*mp+2)/5+1;
+  long month=mp<10 ? mp+3 : mp-9;
+  long year=yearOfEra+era*400+(month<=2 ? 1 : 0);
+  if (year<=1601 || year>9999) return false; // 1601: the date is not set
+  return libstoff::convertToDateTime(uint32_t(10000*year+100*month+day),
+                                     uint32_t(1000000*(seconds/3600)+10000*((seconds/60)%60)+100*(seconds%60)), dateTime);
+}
+
 }
 
 // constructor/destructor
@@ -332,10 +352,11 @@ bool STOFFOLEParser::parse(STOFFInputStreamPtr file)
       asciiFile.open(oleName);
 
       bool ok = true;
+      librevenge::RVNGPropertyList metaData; // unused, the meta data are retrieved by the main parsers
       try {
         if (readObjInfo(ole, base, asciiFile));
         else if (readOle(ole, base, asciiFile));
-        else if (readSummaryInformation(ole, base, asciiFile));
+        else if (readSummaryInformation(ole, base, metaData, asciiFile));
         else
           ok = false;
       }
@@ -419,7 +440,7 @@ bool STOFFOLEParser::readOle(STOFFInputStreamPtr ip, std::string const &oleName,
 }
 
 bool STOFFOLEParser::readSummaryInformation(STOFFInputStreamPtr input, std::string const &oleName,
-    libstoff::DebugFile &ascii)
+    librevenge::RVNGPropertyList &metaData, libstoff::DebugFile &ascii)
 {
   if (oleName!="SummaryInformation") return false;
   input->seek(0, librevenge::RVNG_SEEK_SET);
@@ -506,6 +527,7 @@ bool STOFFOLEParser::readSummaryInformation(STOFFInputStreamPtr input, std::stri
   ascii.addPos(pos);
   ascii.addNote(f.str().c_str());
 
+  int codePage=-1;
   for (auto const posToType : posToTypeMap) {
     pos=posToType.first;
     input->seek(pos, librevenge::RVNG_SEEK_SET);
@@ -524,9 +546,47 @@ bool STOFFOLEParser::readSummaryInformation(STOFFInputStreamPtr input, std::stri
       std::string text("");
       for (long c=0; c < sSz; ++c) text+=char(input->readULong(1));
       f << text;
+      text=text.substr(0, text.find('\0'));
+      // the summary keys: see [MS-OLEPS] 2.25.1
+      static char const *attribNames[]= {
+        nullptr, nullptr, "dc:title", "dc:subject", "meta:initial-creator", "meta:keywords", "dc:description", nullptr, "dc:creator"
+      };
+      auto id=posToType.second;
+      if (id>=0 && id<9 && attribNames[id] && !text.empty()) {
+        librevenge::RVNGString attrib;
+        if (codePage==65001)
+          attrib=text.c_str();
+        else { // codepage 1252 or unknown, let use latin1
+          std::string unicode;
+          for (auto c : text) libstoff::appendUnicode(uint32_t(static_cast<unsigned char>(c)), unicode);
+          attrib=unicode.c_str();
+        }
+        metaData.insert(attribNames[id], attrib);
+      }
+    }
+    else if (type==0x2) {
+      auto value=int(input->readLong(2));
+      f << "val=" << value << ",";
+      if (posToType.second==1) codePage=int(uint16_t(value));
     }
     else if (type==0x40) {
-      f << "dateTime,"; // readme 8 byte
+      f << "dateTime,";
+      if (pos+12>input->size()) {
+        STOFF_DEBUG_MSG(("STOFFOLEParser::readSummaryInformation: date time seems bad\n"));
+        f << "###";
+        ascii.addPos(pos);
+        ascii.addNote(f.str().c_str());
+        continue;
+      }
+      auto low=uint64_t(input->readULong(4));
+      auto fileTime=(uint64_t(input->readULong(4))<<32)|low;
+      std::string dateTime;
+      static char const *attribNames[]= { "meta:print-date", "meta:creation-date", "dc:date" };
+      auto id=posToType.second;
+      if (id>=11 && id<=13 && fileTime && STOFFOLEParserInternal::convertFileTime(fileTime, dateTime)) {
+        f << dateTime << ",";
+        metaData.insert(attribNames[id-11], dateTime.c_str());
+      }
     }
     else {
       STOFF_DEBUG_MSG(("STOFFOLEParser::readSummaryInformation: find unknown type\n"));
@@ -232,10 +232,12 @@ public:
     mutable bool m_inUse;
   };
 
-protected:
-  //! the summary information
+  /** tries to read the summary information: "SummaryInformation" and to store
+      the title, the author, the dates... in metaData */
   static bool readSummaryInformation(STOFFInputStreamPtr input, std::string const &oleName,
-                                     libstoff::DebugFile &ascii);
+                                     librevenge::RVNGPropertyList &metaData, libstoff::DebugFile &ascii);
+
+protected:
   //!  parse the "CompObj" contains : UserType,ClipName,ProgIdName
   bool readCompObj(STOFFInputStreamPtr ip, OleDirectory &directory);
   //!  the "Ole" small structure : unknown contain
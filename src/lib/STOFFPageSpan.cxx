@@ -137,7 +137,7 @@ bool STOFFPageSpan::operator==(std::shared_ptr<STOFFPageSpan> const &page2) cons
   if (page2.get() == this) return true;
 
   for (int i=0; i<3; ++i) {
-    if (m_propertiesList[i].getPropString() != page2->m_propertiesList[i].getPropString())
+    if (libstoff::comparePropertyList(m_propertiesList[i], page2->m_propertiesList[i])!=0)
       return false;
   }
   for (int i=0; i<2; ++i) {
@@ -47,6 +47,8 @@ STOFFParserState::STOFFParserState(STOFFParserState::Type type, STOFFInputStream
   , m_input(input)
   , m_header(header)
   , m_pageSpan()
+  , m_textOnly(false)
+  , m_pageRange(0,0)
   , m_listManager()
   , m_graphicListener()
   , m_spreadsheetListener()
@@ -67,6 +67,10 @@ public:
   STOFFHeader *m_header;
   //! the actual document size
   STOFFPageSpan m_pageSpan;
+  //! a flag to know if we only need to retrieve the document's text
+  bool m_textOnly;
+  //! the range of pages to send: first, last (from 1), 0 means no limit
+  STOFFVec2i m_pageRange;
 
   //! the list manager
   STOFFListManagerPtr m_listManager;
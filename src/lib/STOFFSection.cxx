@@ -47,7 +47,7 @@ STOFFSection::~STOFFSection()
 
 bool STOFFSection::operator!=(STOFFSection const &sec) const
 {
-  return m_propertyList.getPropString()!=sec.m_propertyList.getPropString();
+  return libstoff::comparePropertyList(m_propertyList, sec.m_propertyList)!=0;
 }
 
 void STOFFSection::addTo(librevenge::RVNGPropertyList &pList) const
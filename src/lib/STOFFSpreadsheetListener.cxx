@@ -45,8 +45,8 @@
 #include <cmath>
 #include <cstring>
 #include <iomanip>
-#include <set>
 #include <sstream>
+#include <unordered_set>
 
 #include <librevenge/librevenge.h>
 
@@ -117,14 +117,14 @@ struct DocumentState {
   /// the list of marker corresponding to sent list
   std::vector<int> m_sentListMarkers;
   /** a map cell's format to id */
-  std::map<librevenge::RVNGString,int> m_numberingIdMap;
+  std::map<librevenge::RVNGPropertyList,int,libstoff::PropertyListLess> m_numberingIdMap;
   std::vector<STOFFSubDocumentPtr> m_subDocuments; /** list of document actually open */
   //! the set of defined font style
-  std::set<librevenge::RVNGString> m_definedFontStyleSet;
+  std::unordered_set<librevenge::RVNGString, libstoff::RVNGStringHash> m_definedFontStyleSet;
   //! the set of defined graphic style
-  std::set<librevenge::RVNGString> m_definedGraphicStyleSet;
+  std::unordered_set<librevenge::RVNGString, libstoff::RVNGStringHash> m_definedGraphicStyleSet;
   //! the set of defined paragraph style
-  std::set<librevenge::RVNGString> m_definedParagraphStyleSet;
+  std::unordered_set<librevenge::RVNGString, libstoff::RVNGStringHash> m_definedParagraphStyleSet;
   //! an empty section
   STOFFSection m_section;
 private:
@@ -146,7 +146,7 @@ struct State {
   }
 
   //! a buffer to stored the text
-  librevenge::RVNGString m_textBuffer;
+  STOFFListenerTextBuffer m_textBuffer;
   //! the number of tabs to add
   int m_numDeferredTabs;
 
@@ -195,7 +195,7 @@ private:
 };
 
 State::State()
-  : m_textBuffer("")
+  : m_textBuffer()
   , m_numDeferredTabs(0)
 
   , m_font()
@@ -333,7 +333,19 @@ void STOFFSpreadsheetListener::insertUnicode(uint32_t val)
 
   _flushDeferredTabs();
   if (!m_ps->m_isSpanOpened) _openSpan();
-  libstoff::appendUnicode(val, m_ps->m_textBuffer);
+  m_ps->m_textBuffer.appendUnicode(val);
+}
+
+void STOFFSpreadsheetListener::insertUnicodeRun(uint32_t const *characters, size_t numCharacters)
+{
+  if (!m_ps->canWriteText()) {
+    STOFF_DEBUG_MSG(("STOFFSpreadsheetListener::insertUnicodeRun: called outside a text zone\n"));
+    return;
+  }
+  if (!numCharacters) return;
+  _flushDeferredTabs();
+  if (!m_ps->m_isSpanOpened) _openSpan();
+  m_ps->m_textBuffer.appendUnicode(characters, numCharacters);
 }
 
 void STOFFSpreadsheetListener::insertUnicodeString(librevenge::RVNGString const &str)
@@ -942,29 +954,10 @@ void STOFFSpreadsheetListener::_flushDeferredTabs()
 
 void STOFFSpreadsheetListener::_flushText()
 {
-  if (m_ps->m_textBuffer.len() == 0  || !m_ps->canWriteText()) return;
+  if (m_ps->m_textBuffer.empty()  || !m_ps->canWriteText()) return;
 
   // when some many ' ' follows each other, call insertSpace
-  librevenge::RVNGString tmpText;
-  int numConsecutiveSpaces = 0;
-  librevenge::RVNGString::Iter i(m_ps->m_textBuffer);
-  for (i.rewind(); i.next();) {
-    if (*(i()) == 0x20) // this test is compatible with unicode format
-      numConsecutiveSpaces++;
-    else
-      numConsecutiveSpaces = 0;
-
-    if (numConsecutiveSpaces > 1) {
-      if (tmpText.len() > 0) {
-        m_documentInterface->insertText(tmpText);
-        tmpText.clear();
-      }
-      m_documentInterface->insertSpace();
-    }
-    else
-      tmpText.append(i());
-  }
-  m_documentInterface->insertText(tmpText);
+  m_ps->m_textBuffer.send(*m_documentInterface);
   m_ps->m_textBuffer.clear();
 }
 
@@ -1446,6 +1439,26 @@ void STOFFSpreadsheetListener::closeSheetRow()
   m_documentInterface->closeSheetRow();
 }
 
+librevenge::RVNGString STOFFSpreadsheetListener::defineSheetNumberingStyle(librevenge::RVNGPropertyList const &numberingStyle)
+{
+  librevenge::RVNGString name;
+  auto it=m_ds->m_numberingIdMap.find(numberingStyle);
+  if (it!=m_ds->m_numberingIdMap.end()) {
+    name.sprintf("Numbering%d", it->second);
+    return name;
+  }
+  if (numberingStyle.empty())
+    return name;
+  auto numberingId=int(m_ds->m_numberingIdMap.size());
+  name.sprintf("Numbering%d", numberingId);
+
+  librevenge::RVNGPropertyList numList(numberingStyle);
+  numList.insert("librevenge:name", name);
+  m_documentInterface->defineSheetNumberingStyle(numList);
+  m_ds->m_numberingIdMap[numberingStyle]=numberingId;
+  return name;
+}
+
 void STOFFSpreadsheetListener::openSheetCell(STOFFCell const &cell, STOFFCellContent const &content, int numRepeated)
 {
   if (!m_ds->m_isSheetRowOpened) {
@@ -1463,25 +1476,11 @@ void STOFFSpreadsheetListener::openSheetCell(STOFFCell const &cell, STOFFCellCon
     propList.insert("table:number-columns-repeated", numRepeated);
   STOFFCell::Format const &format=cell.getFormat();
   if (!format.hasBasicFormat()) {
-    int numberingId=-1;
-    librevenge::RVNGPropertyList const &numberingStyle=cell.getNumberingStyle();
-    librevenge::RVNGString hashKey = numberingStyle.getPropString();
-    std::stringstream name;
-    if (m_ds->m_numberingIdMap.find(hashKey)!=m_ds->m_numberingIdMap.end()) {
-      numberingId=m_ds->m_numberingIdMap.find(hashKey)->second;
-      name << "Numbering" << numberingId;
-    }
-    else if (!numberingStyle.empty()) {
-      numberingId=int(m_ds->m_numberingIdMap.size());
-      name << "Numbering" << numberingId;
-
-      librevenge::RVNGPropertyList numList(numberingStyle);
-      numList.insert("librevenge:name", name.str().c_str());
-      m_documentInterface->defineSheetNumberingStyle(numList);
-      m_ds->m_numberingIdMap[hashKey]=numberingId;
-    }
-    if (numberingId>=0)
-      propList.insert("librevenge:numbering-name", name.str().c_str());
+    librevenge::RVNGString name=cell.getNumberingStyleName();
+    if (name.empty())
+      name=defineSheetNumberingStyle(cell.getNumberingStyle());
+    if (!name.empty())
+      propList.insert("librevenge:numbering-name", name);
   }
   // formula
   if (content.m_formula.size()) {
@@ -137,6 +137,8 @@ public:
   void openSheetRow(float h, librevenge::RVNGUnit unit, int numRepeated=1);
   /** closes this row */
   void closeSheetRow();
+  /** defines a sheet numbering style (if it is not already defined) and returns its name or an empty string */
+  librevenge::RVNGString defineSheetNumberingStyle(librevenge::RVNGPropertyList const &numberingStyle);
   /** open a cell */
   void openSheetCell(STOFFCell const &cell, STOFFCellContent const &content, int numRepeated=1);
   /** close a cell */
@@ -153,6 +155,9 @@ public:
   /** adds an unicode character.
    *  By convention if \a character=0xfffd(undef), no character is added */
   void insertUnicode(uint32_t character) final;
+  /** adds a list of unicode characters which does not contain any
+      control character nor the undef character */
+  void insertUnicodeRun(uint32_t const *characters, size_t numCharacters) final;
   //! adds a unicode string
   void insertUnicodeString(librevenge::RVNGString const &str) final;
 
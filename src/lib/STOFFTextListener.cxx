@@ -40,8 +40,8 @@
 
 #include <cstring>
 #include <iomanip>
-#include <set>
 #include <sstream>
+#include <unordered_set>
 #include <time.h>
 
 #include <librevenge/librevenge.h>
@@ -112,11 +112,11 @@ struct TextState {
   std::vector<int> m_sentListMarkers;
   std::vector<STOFFSubDocumentPtr> m_subDocuments; /** list of document actually open */
   //! the set of defined font style
-  std::set<librevenge::RVNGString> m_definedFontStyleSet;
+  std::unordered_set<librevenge::RVNGString, libstoff::RVNGStringHash> m_definedFontStyleSet;
   //! the set of defined graphic style
-  std::set<librevenge::RVNGString> m_definedGraphicStyleSet;
+  std::unordered_set<librevenge::RVNGString, libstoff::RVNGStringHash> m_definedGraphicStyleSet;
   //! the set of defined paragraph style
-  std::set<librevenge::RVNGString> m_definedParagraphStyleSet;
+  std::unordered_set<librevenge::RVNGString, libstoff::RVNGStringHash> m_definedParagraphStyleSet;
 
 private:
   TextState(const TextState &);
@@ -131,7 +131,7 @@ struct State {
   ~State() { }
 
   //! a buffer to stored the text
-  librevenge::RVNGString m_textBuffer;
+  STOFFListenerTextBuffer m_textBuffer;
   //! the number of tabs to add
   int m_numDeferredTabs;
 
@@ -185,7 +185,7 @@ private:
 };
 
 State::State()
-  : m_textBuffer("")
+  : m_textBuffer()
   , m_numDeferredTabs(0)
 
   , m_font()
@@ -312,7 +312,15 @@ void STOFFTextListener::insertUnicode(uint32_t val)
 
   _flushDeferredTabs();
   if (!m_ps->m_isSpanOpened) _openSpan();
-  libstoff::appendUnicode(val, m_ps->m_textBuffer);
+  m_ps->m_textBuffer.appendUnicode(val);
+}
+
+void STOFFTextListener::insertUnicodeRun(uint32_t const *characters, size_t numCharacters)
+{
+  if (!numCharacters) return;
+  _flushDeferredTabs();
+  if (!m_ps->m_isSpanOpened) _openSpan();
+  m_ps->m_textBuffer.appendUnicode(characters, numCharacters);
 }
 
 void STOFFTextListener::insertUnicodeString(librevenge::RVNGString const &str)
@@ -1038,29 +1046,10 @@ void STOFFTextListener::_flushDeferredTabs()
 
 void STOFFTextListener::_flushText()
 {
-  if (m_ps->m_textBuffer.len() == 0) return;
+  if (m_ps->m_textBuffer.empty()) return;
 
   // when some many ' ' follows each other, call insertSpace
-  librevenge::RVNGString tmpText;
-  int numConsecutiveSpaces = 0;
-  librevenge::RVNGString::Iter i(m_ps->m_textBuffer);
-  for (i.rewind(); i.next();) {
-    if (*(i()) == 0x20) // this test is compatible with unicode format
-      numConsecutiveSpaces++;
-    else
-      numConsecutiveSpaces = 0;
-
-    if (numConsecutiveSpaces > 1) {
-      if (tmpText.len() > 0) {
-        m_documentInterface->insertText(tmpText);
-        tmpText.clear();
-      }
-      m_documentInterface->insertSpace();
-    }
-    else
-      tmpText.append(i());
-  }
-  m_documentInterface->insertText(tmpText);
+  m_ps->m_textBuffer.send(*m_documentInterface);
   m_ps->m_textBuffer.clear();
 }
 
@@ -144,6 +144,9 @@ public:
   /** adds an unicode character.
    *  By convention if \a character=0xfffd(undef), no character is added */
   void insertUnicode(uint32_t character) final;
+  /** adds a list of unicode characters which does not contain any
+      control character nor the undef character */
+  void insertUnicodeRun(uint32_t const *characters, size_t numCharacters) final;
   //! adds a unicode string
   void insertUnicodeString(librevenge::RVNGString const &str) final;
 
@@ -113,10 +113,32 @@ bool Field::send(STOFFListenerPtr &listener, StarState &state) const
     STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: can not find the listener\n"));
     return false;
   }
-  STOFFField field;
+  if (m_type==21) {
+    static bool first=true;
+    if (first) {
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: sending macros is not implemented\n"));
+      first=false;
+    }
+    return true;
+  }
+  // a field can be sent many times (in a header, ...), so create it only once
+  if (!m_isFieldCreated) {
+    m_isFieldCreated=true;
+    std::shared_ptr<STOFFField> field(new STOFFField);
+    if (updateField(*field, state))
+      m_field=field;
+  }
+  if (!m_field)
+    return false;
+  listener->insertField(*m_field);
+  return true;
+}
+
+bool Field::updateField(STOFFField &field, StarState &state) const
+{
   if (m_type==1) {
     if (m_name.empty()) {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: can not find the user name\n"));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::updateField: can not find the user name\n"));
       return false;
     }
     field.m_propertyList.insert("librevenge:field-type", "text:user-defined");
@@ -135,12 +157,12 @@ bool Field::send(STOFFListenerPtr &listener, StarState &state) const
       field.m_propertyList.insert("text:display", wh[m_format]);
     }
     else {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: unknown filename type=%d\n", m_format));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::updateField: unknown filename type=%d\n", m_format));
     }
   }
   else if (m_type==3) {
     if (m_name.empty()) {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: can not find the dbName\n"));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::updateField: can not find the dbName\n"));
       return false;
     }
     field.m_propertyList.insert("librevenge:field-type", "text:database-name");
@@ -156,7 +178,7 @@ bool Field::send(STOFFListenerPtr &listener, StarState &state) const
       field.m_propertyList.insert("text:display", wh[m_format]);
     }
     else {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: unknown chapter type=%d\n", m_format));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::updateField: unknown chapter type=%d\n", m_format));
     }
     if (m_level>=0)
       field.m_propertyList.insert("text:outline-level", m_level+1);
@@ -170,13 +192,13 @@ bool Field::send(STOFFListenerPtr &listener, StarState &state) const
       field.m_propertyList.insert("librevenge:field-type", wh[m_subType]);
     }
     else {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: unknown doc type=%d\n", m_subType));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::updateField: unknown doc type=%d\n", m_subType));
       return false;
     }
   }
   else if (m_type==10) {
     if (m_name.empty() || m_content.empty()) {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: can not find the expression values\n"));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::updateField: can not find the expression values\n"));
       return false;
     }
     if (m_subType&0x10) {
@@ -193,7 +215,7 @@ bool Field::send(STOFFListenerPtr &listener, StarState &state) const
   }
   else if (m_type==12) {
     if (m_name.empty()) {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: can not find the getRef values\n"));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::updateField: can not find the getRef values\n"));
       return false;
     }
     field.m_propertyList.insert("librevenge:field-type", "text:reference-ref");
@@ -206,14 +228,14 @@ bool Field::send(STOFFListenerPtr &listener, StarState &state) const
       field.m_propertyList.insert("text:reference-format",wh[m_format]);
     }
     else {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: unknown getRef format=%d\n", m_format));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::updateField: unknown getRef format=%d\n", m_format));
     }
     if (!m_content.empty())
       field.m_propertyList.insert("librevenge:field-content", m_content);
   }
   else if (m_type==23) {
     if (m_name.empty()) {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: can not find the expression values\n"));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::updateField: can not find the expression values\n"));
       return false;
     }
     field.m_propertyList.insert("librevenge:field-type", "text:expression");
@@ -237,7 +259,7 @@ bool Field::send(STOFFListenerPtr &listener, StarState &state) const
         field.m_propertyList.insert("librevenge:field-type", wh[m_format]);
       }
       else {
-        STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: sending custom type %d is not implemented\n", m_format));
+        STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::updateField: sending custom type %d is not implemented\n", m_format));
       }
     }
     else if (subType==10) {
@@ -248,7 +270,7 @@ bool Field::send(STOFFListenerPtr &listener, StarState &state) const
         field.m_propertyList.insert("librevenge:field-type", wh[m_format]);
       }
       else {
-        STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: sending custom type %d is not implemented\n", m_format));
+        STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::updateField: sending custom type %d is not implemented\n", m_format));
       }
     }
     else if (subType>=0 && subType<=12) {
@@ -261,7 +283,7 @@ bool Field::send(STOFFListenerPtr &listener, StarState &state) const
       field.m_propertyList.insert("librevenge:field-type", wh[subType]);
     }
     else {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: sending docInfo %d is not implemented\n", subType));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::updateField: sending docInfo %d is not implemented\n", subType));
       return false;
     }
   }
@@ -270,14 +292,6 @@ bool Field::send(STOFFListenerPtr &listener, StarState &state) const
     field.m_propertyList.insert("text:description", m_name);
     field.m_propertyList.insert("librevenge:field-content", m_content);
   }
-  else if (m_type==21) {
-    static bool first=true;
-    if (first) {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: sending macros is not implemented\n"));
-      first=false;
-    }
-    return true;
-  }
   else if (m_type==26) {
     int subType=m_format&0x7FF;
     if (subType>=0 && subType<=5) {
@@ -286,7 +300,7 @@ bool Field::send(STOFFListenerPtr &listener, StarState &state) const
       field.m_propertyList.insert("text:display", wh[subType]);
     }
     else {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: unknown template type=%d\n", m_format));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::updateField: unknown template type=%d\n", m_format));
       return false;
     }
   }
@@ -301,15 +315,14 @@ bool Field::send(STOFFListenerPtr &listener, StarState &state) const
       field.m_propertyList.insert("librevenge:field-type", wh[m_subType]);
     }
     else {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: unknown extUser type=%d\n", m_subType));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::updateField: unknown extUser type=%d\n", m_subType));
       return false;
     }
   }
   else {
-    STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::send: sending type=%d is not implemented\n", m_type));
+    STOFF_DEBUG_MSG(("SWFieldManagerInternal::Field::updateField: sending type=%d is not implemented\n", m_type));
     return false;
   }
-  listener->insertField(field);
   return true;
 }
 
@@ -325,8 +338,8 @@ struct FieldDateTime final : public Field {
   }
   //! destructor
   ~FieldDateTime() final;
-  //! add to send the zone data
-  bool send(STOFFListenerPtr &listener, StarState &state) const final;
+  //! try to create the field to send
+  bool updateField(STOFFField &field, StarState &state) const final;
   //! print a field
   void print(std::ostream &o) const final
   {
@@ -346,14 +359,8 @@ FieldDateTime::~FieldDateTime()
 {
 }
 
-bool FieldDateTime::send(STOFFListenerPtr &listener, StarState &state) const
+bool FieldDateTime::updateField(STOFFField &field, StarState &state) const
 {
-  if (!listener || !listener->canWriteText()) {
-    STOFF_DEBUG_MSG(("SWFieldManagerInternal::FieldDateTime::send: can not find the listener\n"));
-    return false;
-  }
-  STOFFField field;
-
   if (m_type==4 || m_type==36)
     field.m_propertyList.insert("librevenge:field-type", "text:date");
   else if (m_type==5)
@@ -378,9 +385,8 @@ bool FieldDateTime::send(STOFFListenerPtr &listener, StarState &state) const
     }
   }
   else
-    return Field::send(listener, state);
+    return Field::updateField(field, state);
   //TODO: set the format
-  listener->insertField(field);
   return true;
 }
 
@@ -400,8 +406,8 @@ struct FieldDBField final : public Field {
   }
   //! destructor
   ~FieldDBField() final;
-  //! add to send the zone data
-  bool send(STOFFListenerPtr &listener, StarState &state) const final;
+  //! try to create the field to send
+  bool updateField(STOFFField &field, StarState &state) const final;
   //! print a field
   void print(std::ostream &o) const final
   {
@@ -422,17 +428,11 @@ FieldDBField::~FieldDBField()
 {
 }
 
-bool FieldDBField::send(STOFFListenerPtr &listener, StarState &state) const
+bool FieldDBField::updateField(STOFFField &field, StarState &state) const
 {
-  if (!listener || !listener->canWriteText()) {
-    STOFF_DEBUG_MSG(("SWFieldManagerInternal::FieldDBField::send: can not find the listener\n"));
-    return false;
-  }
-  STOFFField field;
-
   if (m_type==0) {
     if (m_colName.empty()) {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::FieldDBField::send: can not find the col value\n"));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::FieldDBField::updateField: can not find the col value\n"));
       return false;
     }
     field.m_propertyList.insert("librevenge:field-type", "text:database-display");
@@ -441,9 +441,8 @@ bool FieldDBField::send(STOFFListenerPtr &listener, StarState &state) const
     field.m_propertyList.insert("text:column-name", m_colName);
   }
   else
-    return Field::send(listener, state);
+    return Field::updateField(field, state);
   //TODO: set the format
-  listener->insertField(field);
   return true;
 }
 
@@ -462,8 +461,8 @@ struct FieldHiddenText final : public Field {
   }
   //! destructor
   ~FieldHiddenText() final;
-  //! add to send the zone data
-  bool send(STOFFListenerPtr &listener, StarState &state) const final;
+  //! try to create the field to send
+  bool updateField(STOFFField &field, StarState &state) const final;
   //! print a field
   void print(std::ostream &o) const final
   {
@@ -481,16 +480,11 @@ FieldHiddenText::~FieldHiddenText()
 {
 }
 
-bool FieldHiddenText::send(STOFFListenerPtr &listener, StarState &state) const
+bool FieldHiddenText::updateField(STOFFField &field, StarState &state) const
 {
-  if (!listener || !listener->canWriteText()) {
-    STOFF_DEBUG_MSG(("SWFieldManagerInternal::FieldHiddenText::send: can not find the listener\n"));
-    return false;
-  }
-  STOFFField field;
   if (m_type==13) {
     if (m_condition.empty()) {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::FieldHiddenText::send: can not find the condition\n"));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::FieldHiddenText::updateField: can not find the condition\n"));
       return false;
     }
     field.m_propertyList.insert("librevenge:field-type", "text:conditional-text");
@@ -506,7 +500,7 @@ bool FieldHiddenText::send(STOFFListenerPtr &listener, StarState &state) const
   }
   else if (m_type==24) {
     if (m_condition.empty()) {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::FieldHiddenText::send: can not find the condition\n"));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::FieldHiddenText::updateField: can not find the condition\n"));
       return false;
     }
     field.m_propertyList.insert("librevenge:field-type", "text:hidden-paragraph");
@@ -514,9 +508,8 @@ bool FieldHiddenText::send(STOFFListenerPtr &listener, StarState &state) const
     field.m_propertyList.insert("text:is-hidden", m_hidden);
   }
   else // also ....
-    return Field::send(listener, state);
+    return Field::updateField(field, state);
   //TODO: set the format
-  listener->insertField(field);
   return true;
 }
 
@@ -607,8 +600,8 @@ struct FieldJumpEdit final : public Field {
   }
   //! destructor
   ~FieldJumpEdit() final;
-  //! add to send the zone data
-  bool send(STOFFListenerPtr &listener, StarState &state) const final;
+  //! try to create the field to send
+  bool updateField(STOFFField &field, StarState &state) const final;
   //! print a field
   void print(std::ostream &o) const final
   {
@@ -623,13 +616,8 @@ FieldJumpEdit::~FieldJumpEdit()
 {
 }
 
-bool FieldJumpEdit::send(STOFFListenerPtr &listener, StarState &state) const
+bool FieldJumpEdit::updateField(STOFFField &field, StarState &state) const
 {
-  if (!listener || !listener->canWriteText()) {
-    STOFF_DEBUG_MSG(("SWFieldManagerInternal::FieldJumpEdit::send: can not find the listener\n"));
-    return false;
-  }
-  STOFFField field;
   if (m_type==34) {
     field.m_propertyList.insert("librevenge:field-type", "text:placeholder");
     field.m_propertyList.insert("librevenge:field-content", m_content);
@@ -638,14 +626,13 @@ bool FieldJumpEdit::send(STOFFListenerPtr &listener, StarState &state) const
       field.m_propertyList.insert("text:placeholder-type",wh[m_format]);
     }
     else {
-      STOFF_DEBUG_MSG(("SWFieldManagerInternal::FieldJumpEdit::send: unknown format=%d\n", m_format));
+      STOFF_DEBUG_MSG(("SWFieldManagerInternal::FieldJumpEdit::updateField: unknown format=%d\n", m_format));
     }
     if (!m_help.empty())
       field.m_propertyList.insert("text:description", m_help);
   }
   else
-    return Field::send(listener, state);
-  listener->insertField(field);
+    return Field::updateField(field, state);
   return true;
 }
 
@@ -665,8 +652,8 @@ struct FieldPageNumber final : public Field {
   }
   //! destructor
   ~FieldPageNumber() final;
-  //! add to send the zone data
-  bool send(STOFFListenerPtr &listener, StarState &state) const final;
+  //! try to create the field to send
+  bool updateField(STOFFField &field, StarState &state) const final;
   //! print a field
   void print(std::ostream &o) const final
   {
@@ -688,13 +675,8 @@ FieldPageNumber::~FieldPageNumber()
 {
 }
 
-bool FieldPageNumber::send(STOFFListenerPtr &listener, StarState &state) const
+bool FieldPageNumber::updateField(STOFFField &field, StarState &state) const
 {
-  if (!listener || !listener->canWriteText()) {
-    STOFF_DEBUG_MSG(("SWFieldManagerInternal::FieldPageNumber::send: can not find the listener\n"));
-    return false;
-  }
-  STOFFField field;
   if (m_type==6) {
     field.m_propertyList.insert("librevenge:field-type", "text:page-number");
     if (m_offset<0)
@@ -703,9 +685,8 @@ bool FieldPageNumber::send(STOFFListenerPtr &listener, StarState &state) const
       field.m_propertyList.insert("text:select-page", "next");
   }
   else // also 31 which is setPageRef
-    return Field::send(listener, state);
+    return Field::updateField(field, state);
   //TODO: set the format
-  listener->insertField(field);
   return true;
 }
 
@@ -807,8 +788,8 @@ struct FieldSetExp final : public Field {
   }
   //! destructor
   ~FieldSetExp() final;
-  //! add to send the zone data
-  bool send(STOFFListenerPtr &listener, StarState &state) const final;
+  //! try to create the field to send
+  bool updateField(STOFFField &field, StarState &state) const final;
   //! print a field
   void print(std::ostream &o) const final
   {
@@ -838,14 +819,9 @@ FieldSetExp::~FieldSetExp()
 {
 }
 
-bool FieldSetExp::send(STOFFListenerPtr &listener, StarState &state) const
+bool FieldSetExp::updateField(STOFFField &field, StarState &state) const
 {
-  if (!listener || !listener->canWriteText()) {
-    STOFF_DEBUG_MSG(("SWFieldManagerInternal::FieldSetExp::send: can not find the listener\n"));
-    return false;
-  }
   //TODO: set the format
-  STOFFField field;
   if (m_type==11) {
     if (m_format&8) // we must also set text:ref-name
       field.m_propertyList.insert("librevenge:field-type", "text:sequence");
@@ -863,8 +839,7 @@ bool FieldSetExp::send(STOFFListenerPtr &listener, StarState &state) const
       field.m_propertyList.insert("librevenge:field-content", m_content);
   }
   else
-    return Field::send(listener, state);
-  listener->insertField(field);
+    return Field::updateField(field, state);
   return true;
 }
 
@@ -890,8 +865,8 @@ struct FieldSetField final : public Field {
   }
   //! destructor
   ~FieldSetField() final;
-  //! add to send the zone data
-  bool send(STOFFListenerPtr &listener, StarState &state) const final;
+  //! try to create the field to send
+  bool updateField(STOFFField &field, StarState &state) const final;
   //! print a field
   void print(std::ostream &o) const final
   {
@@ -915,14 +890,9 @@ FieldSetField::~FieldSetField()
 {
 }
 
-bool FieldSetField::send(STOFFListenerPtr &listener, StarState &state) const
+bool FieldSetField::updateField(STOFFField &field, StarState &state) const
 {
-  if (!listener || !listener->canWriteText()) {
-    STOFF_DEBUG_MSG(("SWFieldManagerInternal::FieldSetField::send: can not find the listener\n"));
-    return false;
-  }
   //TODO: set the format
-  STOFFField field;
   if (m_type==28) {
     field.m_propertyList.insert("librevenge:field-type", "text:database-row-select");
     updateDatabaseName(m_dbName, field.m_propertyList);
@@ -935,8 +905,7 @@ bool FieldSetField::send(STOFFListenerPtr &listener, StarState &state) const
     // CHECKME: we need to set also text:table-type
   }
   else // also 27,29...
-    return Field::send(listener, state);
-  listener->insertField(field);
+    return Field::updateField(field, state);
   return true;
 }
 
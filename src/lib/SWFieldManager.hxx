@@ -61,6 +61,8 @@ struct Field {
     , m_textValue("")
     , m_doubleValue(0)
     , m_level(0)
+    , m_isFieldCreated(false)
+    , m_field()
   {
   }
   //! destructor
@@ -73,6 +75,8 @@ struct Field {
   }
   //! add to send the zone data
   virtual bool send(STOFFListenerPtr &listener, StarState &state) const;
+  //! try to create the field to send, returns false if the field can not be sent
+  virtual bool updateField(STOFFField &field, StarState &state) const;
   //! print a field
   virtual void print(std::ostream &o) const;
   //! the field type
@@ -91,6 +95,10 @@ struct Field {
   double m_doubleValue;
   //! the chapter level
   int m_level;
+  //! a flag to know if m_field is already created
+  mutable bool m_isFieldCreated;
+  //! the field to send (created when the field is sent for the first time)
+  mutable std::shared_ptr<STOFFField> m_field;
 protected:
   //! copy constructor
   Field(const Field &) = default;
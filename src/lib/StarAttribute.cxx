@@ -31,6 +31,7 @@
 * instead of those above.
 */
 
+#include <atomic>
 #include <cstring>
 #include <iomanip>
 #include <iostream>
@@ -60,6 +61,11 @@
 /** Internal: the structures of a StarAttribute */
 namespace StarAttributeInternal
 {
+//! the number of StarAttributeDoneSet alive in this thread
+static thread_local int s_numDoneSets=0;
+//! the generation of the outermost StarAttributeDoneSet alive in this thread
+static thread_local unsigned long s_firstDoneGeneration=0;
+
 //! xml attribute of StarAttributeInternal
 class StarAttributeXML final : public StarAttributeVoid
 {
@@ -82,18 +88,45 @@ StarAttributeXML::~StarAttributeXML()
 {
 }
 ////////////////////////////////////////
-//! Internal: the state of a StarAttribute
+/** Internal: the state of a StarAttributeManager
+
+    \note this state only stores the prototypes of the attributes, it is
+    created once and then shared (read-only) by all the documents */
 struct State {
+  //! returns the process-wide state
+  static State const &get()
+  {
+    static State const state;
+    return state;
+  }
+  //! returns the prototype corresponding to a which or 0
+  StarAttribute const *getPrototype(int which) const
+  {
+    if (which<0 || which>=int(m_prototypeList.size()))
+      return nullptr;
+    return m_prototypeList[size_t(which)].get();
+  }
+protected:
   //! constructor
-  State() : m_whichToAttributeMap()
+  State() : m_whichToAttributeMap(), m_prototypeList()
   {
     initAttributeMap();
+    m_prototypeList.resize(size_t(StarAttribute::SDRATTR_3DSCENE_RESERVED_20)+1);
+    for (auto const &it : m_whichToAttributeMap) {
+      if (it.first<0 || it.first>=int(m_prototypeList.size())) {
+        STOFF_DEBUG_MSG(("StarAttributeInternal::State::State: find unexpected which=%d\n", it.first));
+        continue;
+      }
+      m_prototypeList[size_t(it.first)]=it.second;
+    }
+    m_whichToAttributeMap.clear();
   }
   //! init the attribute map list
   void initAttributeMap();
-  //! a map which to an attribute
+  //! a map which to an attribute (only used to create the prototype list)
   std::map<int, std::shared_ptr<StarAttribute> > m_whichToAttributeMap;
-protected:
+  //! the list of prototypes indexed by which
+  std::vector<std::shared_ptr<StarAttribute const> > m_prototypeList;
   //! add a void attribute
   void addAttributeVoid(StarAttribute::Type type, std::string const &debugName)
   {
@@ -369,34 +402,93 @@ void State::initAttributeMap()
 ////////////////////////////////////////////////////////////
 // basic attribute function
 ////////////////////////////////////////////////////////////
+StarAttributeDoneSet::StarAttributeDoneSet()
+  : m_generation(0)
+  , m_firstGeneration(0)
+  , m_restoreList()
+{
+  // 0 is the generation of the attributes which have never been visited
+  static std::atomic<unsigned long> lastGeneration(0);
+  m_generation=++lastGeneration;
+  // the sets of a thread are nested, so the sets which are alive have a
+  // generation greater or equal to the outermost one
+  if (StarAttributeInternal::s_numDoneSets++==0)
+    StarAttributeInternal::s_firstDoneGeneration=m_generation;
+  m_firstGeneration=StarAttributeInternal::s_firstDoneGeneration;
+}
+
+StarAttributeDoneSet::~StarAttributeDoneSet()
+{
+  for (auto it=m_restoreList.rbegin(); it!=m_restoreList.rend(); ++it)
+    it->first->m_doneGeneration=it->second;
+  --StarAttributeInternal::s_numDoneSets;
+}
+
 StarAttribute::~StarAttribute()
 {
 }
 
-void StarAttributeItemSet::addTo(StarState &state, std::set<StarAttribute const *> &done) const
+bool StarAttribute::isTextAttribute() const
 {
-  if (done.find(this)!=done.end()) {
+  switch (m_type) {
+  case ATTR_TXT_INETFMT:
+  case ATTR_TXT_REFMARK:
+  case ATTR_TXT_FIELD:
+  case ATTR_TXT_FLYCNT:
+  case ATTR_TXT_FTN:
+  case ATTR_TXT_SOFTHYPH:
+  case ATTR_TXT_HARDBLANK:
+  case ATTR_EE_FEATURE_TAB:
+  case ATTR_EE_FEATURE_LINEBR:
+  case ATTR_EE_FEATURE_FIELD:
+    return true;
+  default:
+    break;
+  }
+  return false;
+}
+
+void StarAttributeItemSet::addTo(StarState &state, StarAttributeDoneSet &done) const
+{
+  if (done.contains(this)) {
     STOFF_DEBUG_MSG(("StarAttributeItemSet::addTo: find a cycle\n"));
     return;
   }
   done.insert(this);
-  StarItemSet finalSet;
-  bool newSet=false;
+  StarItemSet const *styleSet=nullptr;
   if (state.m_global->m_pool && !m_itemSet.m_style.empty()) {
-    finalSet=m_itemSet;
-    state.m_global->m_pool->updateUsingStyles(finalSet);
-    newSet=true;
+    auto const *style=state.m_global->m_pool->findStyleWithFamily(m_itemSet.m_style, m_itemSet.m_family);
+    // the style's item set already contains its parents' items, see StarItemPool::updateStyles
+    if (style) styleSet=&style->m_itemSet;
   }
-  StarItemSet const &set=newSet ? finalSet : m_itemSet;
-  for (auto const &it : set.m_whichToItemMap) {
-    if (it.second && it.second->m_attribute)
-      it.second->m_attribute->addTo(state, done);
+  if (!styleSet) {
+    for (auto const &it : m_itemSet.m_whichToItemMap) {
+      if (it.second && it.second->m_attribute)
+        it.second->m_attribute->addTo(state, done);
+    }
+    return;
+  }
+  // merge the two lists in the which order, the set's items have priority
+  auto const &items=m_itemSet.m_whichToItemMap;
+  auto const &styleItems=styleSet->m_whichToItemMap;
+  auto it=items.begin();
+  auto sIt=styleItems.begin();
+  while (it!=items.end() || sIt!=styleItems.end()) {
+    StarItem const *item;
+    if (sIt==styleItems.end() || (it!=items.end() && it->first<=sIt->first)) {
+      if (sIt!=styleItems.end() && it->first==sIt->first) ++sIt;
+      item=it++->second.get();
+    }
+    else
+      item=sIt++->second.get();
+    if (item && item->m_attribute)
+      item->m_attribute->addTo(state, done);
   }
 }
 
-void StarAttributeItemSet::print(libstoff::DebugStream &o, std::set<StarAttribute const *> &done) const
+void StarAttributeItemSet::print(libstoff::DebugStream &o, StarAttributeDoneSet &done) const
 {
-  if (done.find(this)!=done.end()) {
+  if (done.contains(this)) {
     STOFF_DEBUG_MSG(("StarAttributeItemSet::print: find a cycle\n"));
     o << "###cycle[" << m_debugName << "]";
     return;
@@ -536,9 +628,9 @@ bool StarAttributeVoid::read(StarZone &zone, int /*vers*/, long /*endPos*/, Star
   return true;
 }
 
-bool StarAttributeItemSet::send(STOFFListenerPtr &listener, StarState &state, std::set<StarAttribute const *> &done) const
+bool StarAttributeItemSet::send(STOFFListenerPtr &listener, StarState &state, StarAttributeDoneSet &done) const
 {
-  if (done.find(this)!=done.end()) {
+  if (done.contains(this)) {
     STOFF_DEBUG_MSG(("StarAttributeItemSet::send: find a cycle\n"));
     return false;
   }
@@ -555,7 +647,8 @@ bool StarAttributeItemSet::send(STOFFListenerPtr &listener, StarState &state, st
 ////////////////////////////////////////////////////////////
 
 StarAttributeManager::StarAttributeManager()
-  : m_state(new StarAttributeInternal::State)
+  : m_valueKeyToAttributeMap()
+  , m_state(StarAttributeInternal::State::get())
 {
 }
 
@@ -574,12 +667,25 @@ std::shared_ptr<StarAttribute> StarAttributeManager::getDummyAttribute(int id)
 
 std::shared_ptr<StarAttribute> StarAttributeManager::getDefaultAttribute(int nWhich)
 {
-  if (m_state->m_whichToAttributeMap.find(nWhich)!=m_state->m_whichToAttributeMap.end() &&
-      m_state->m_whichToAttributeMap.find(nWhich)->second)
-    return m_state->m_whichToAttributeMap.find(nWhich)->second->create();
+  auto const *prototype=m_state.getPrototype(nWhich);
+  if (prototype)
+    return getSharedAttribute(nWhich, prototype->create());
   return getDummyAttribute();
 }
 
+std::shared_ptr<StarAttribute> StarAttributeManager::getSharedAttribute(int nWhich, std::shared_ptr<StarAttribute> const &attribute)
+{
+  uint64_t key;
+  if (!attribute || !attribute->getValueKey(key))
+    return attribute;
+  auto const mapKey=std::make_pair(nWhich, key);
+  auto it=m_valueKeyToAttributeMap.find(mapKey);
+  if (it!=m_valueKeyToAttributeMap.end())
+    return it->second;
+  m_valueKeyToAttributeMap[mapKey]=attribute;
+  return attribute;
+}
+
 std::shared_ptr<StarAttribute> StarAttributeManager::readAttribute(StarZone &zone, int nWhich, int nVers, long lastPos, StarObject &object)
 {
   STOFFInputStreamPtr input=zone.input();
@@ -588,9 +694,9 @@ std::shared_ptr<StarAttribute> StarAttributeManager::readAttribute(StarZone &zon
   f << "Entries(StarAttribute)[" << zone.getRecordLevel() << "]:";
 
   long pos=input->tell();
-  if (m_state->m_whichToAttributeMap.find(nWhich)!=m_state->m_whichToAttributeMap.end() &&
-      m_state->m_whichToAttributeMap.find(nWhich)->second) {
-    auto attrib=m_state->m_whichToAttributeMap.find(nWhich)->second->create();
+  auto const *prototype=m_state.getPrototype(nWhich);
+  if (prototype) {
+    auto attrib=prototype->create();
     if (!attrib || !attrib->read(zone, nVers, lastPos, object)) {
       STOFF_DEBUG_MSG(("StarAttributeManager::readAttribute: can not read an attribute\n"));
       f << "###bad";
@@ -598,7 +704,7 @@ std::shared_ptr<StarAttribute> StarAttributeManager::readAttribute(StarZone &zon
       ascFile.addNote(f.str().c_str());
       return std::shared_ptr<StarAttribute>();
     }
-    return attrib;
+    return getSharedAttribute(nWhich, attrib);
   }
 
   int val;
@@ -38,8 +38,11 @@
 #ifndef STAR_ATTRIBUTE
 #  define STAR_ATTRIBUTE
 
+#include <cstring>
 #include <set>
 #include <sstream>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "STOFFDebug.hxx"
@@ -53,11 +56,45 @@ namespace StarAttributeInternal
 struct State;
 }
 
+class StarAttribute;
 class StarItemPool;
 class StarObject;
 class StarState;
 class StarZone;
 
+/** \brief the set of attributes already visited by a addTo, send or
+    print call, used to detect the cycles
+
+    \note each set uses a new generation number which is stored in the
+    visited attributes, so marking an attribute does not allocate any
+    memory. When a traversal starts another traversal (for instance, a
+    fly frame sent from a character attribute), the inner set stores the
+    marks of the outer sets which it overwrites and restores them when
+    it is destroyed.
+ */
+class StarAttributeDoneSet
+{
+public:
+  //! constructor: creates a new generation
+  StarAttributeDoneSet();
+  //! destructor: restores the marks of the enclosing sets
+  ~StarAttributeDoneSet();
+  //! returns true if an attribute is already visited
+  bool contains(StarAttribute const *attribute) const;
+  //! marks an attribute as visited
+  void insert(StarAttribute const *attribute);
+private:
+  //! the generation
+  unsigned long m_generation;
+  //! the generation of the outermost set which is alive when this set is created
+  unsigned long m_firstGeneration;
+  //! the marks of the enclosing sets overwritten by this set: attribute, generation
+  std::vector<std::pair<StarAttribute const *, unsigned long> > m_restoreList;
+
+  StarAttributeDoneSet(StarAttributeDoneSet const &) = delete;
+  StarAttributeDoneSet &operator=(StarAttributeDoneSet const &) = delete;
+};
+
 //! virtual class used to store the different attribute
 class StarAttribute
 {
@@ -738,6 +775,8 @@ public:
   {
     return m_type;
   }
+  //! returns true if the attribute can contain or modify the text (a field, a footnote, a link, a tabulation, ...)
+  bool isTextAttribute() const;
   //! create a new attribute
   virtual std::shared_ptr<StarAttribute> create() const=0;
   //! read an attribute zone
@@ -745,21 +784,21 @@ public:
   //! add to a state
   void addTo(StarState &state) const
   {
-    std::set<StarAttribute const *> done;
+    StarAttributeDoneSet done;
     addTo(state, done);
   }
   //! add to send the zone data
   bool send(STOFFListenerPtr &listener, StarState &state) const
   {
-    std::set<StarAttribute const *> done;
+    StarAttributeDoneSet done;
     return send(listener, state, done);
   }
   //! add to a state(internal)
-  virtual void addTo(StarState &/*state*/, std::set<StarAttribute const *> &/*done*/) const
+  virtual void addTo(StarState &/*state*/, StarAttributeDoneSet &/*done*/) const
   {
   }
   //! try to send the child zone(internal)
-  virtual bool send(STOFFListenerPtr &/*listener*/, StarState &/*state*/, std::set<StarAttribute const *> &/*done*/) const
+  virtual bool send(STOFFListenerPtr &/*listener*/, StarState &/*state*/, StarAttributeDoneSet &/*done*/) const
   {
     return false;
   }
@@ -769,9 +808,9 @@ public:
     return m_debugName;
   }
   //! debug function to print the data
-  virtual void print(libstoff::DebugStream &o, std::set<StarAttribute const *> &done) const
+  virtual void print(libstoff::DebugStream &o, StarAttributeDoneSet &done) const
   {
-    if (done.find(this)!=done.end()) {
+    if (done.contains(this)) {
       o << m_debugName << ",";
       return;
     }
@@ -783,17 +822,26 @@ public:
   {
     o << m_debugName << ",";
   }
+  /** returns true if the attribute is a simple value, ie. if it is
+      entirely defined by its type and the key, which can be used to
+      share the equal attributes */
+  virtual bool getValueKey(uint64_t &/*key*/) const
+  {
+    return false;
+  }
 protected:
   //! constructor
   StarAttribute(Type type, std::string const &debugName)
     : m_type(type)
     , m_debugName(debugName)
+    , m_doneGeneration(0)
   {
   }
   //! copy constructor
   explicit StarAttribute(StarAttribute const &orig)
     : m_type(orig.m_type)
     , m_debugName(orig.m_debugName)
+    , m_doneGeneration(0)
   {
   }
 
@@ -807,9 +855,27 @@ protected:
   std::string m_debugName;
 
 private:
+  friend class StarAttributeDoneSet;
+  //! the generation of the last StarAttributeDoneSet which has visited this attribute
+  mutable unsigned long m_doneGeneration;
+
   StarAttribute &operator=(StarAttribute const &orig);
 };
 
+inline bool StarAttributeDoneSet::contains(StarAttribute const *attribute) const
+{
+  return attribute && attribute->m_doneGeneration==m_generation;
+}
+
+inline void StarAttributeDoneSet::insert(StarAttribute const *attribute)
+{
+  if (!attribute) return;
+  unsigned long prevGeneration=attribute->m_doneGeneration;
+  if (prevGeneration>=m_firstGeneration && prevGeneration!=m_generation)
+    m_restoreList.push_back(std::make_pair(attribute, prevGeneration));
+  attribute->m_doneGeneration=m_generation;
+}
+
 //! a boolean attribute
 class StarAttributeBool : public StarAttribute
 {
@@ -834,6 +900,12 @@ public:
     if (m_value) o << "=true";
     o << ",";
   }
+  //! returns the value key
+  bool getValueKey(uint64_t &key) const override
+  {
+    key=m_value ? 1 : 0;
+    return true;
+  }
 protected:
   //! copy constructor
   StarAttributeBool(StarAttributeBool const &) = default;
@@ -864,6 +936,12 @@ public:
   {
     o << m_debugName << "[col=" << m_value << "],";
   }
+  //! returns the value key
+  bool getValueKey(uint64_t &key) const override
+  {
+    key=m_value.value();
+    return true;
+  }
 protected:
   //! copy constructor
   StarAttributeColor(StarAttributeColor const &) = default;
@@ -896,6 +974,13 @@ public:
     if (m_value<0 || m_value>0) o << "=" << m_value;
     o << ",";
   }
+  //! returns the value key
+  bool getValueKey(uint64_t &key) const override
+  {
+    static_assert(sizeof(double)==sizeof(uint64_t), "unexpected double size");
+    std::memcpy(&key, &m_value, sizeof(uint64_t));
+    return true;
+  }
 protected:
   //! copy constructor
   StarAttributeDouble(StarAttributeDouble const &) = default;
@@ -932,6 +1017,12 @@ public:
     if (m_value) o << "=" << m_value;
     o << ",";
   }
+  //! returns the value key
+  bool getValueKey(uint64_t &key) const override
+  {
+    key=uint64_t(uint32_t(m_value));
+    return true;
+  }
 
 protected:
   //! copy constructor
@@ -971,6 +1062,12 @@ public:
     if (m_value) o << "=" << m_value;
     o << ",";
   }
+  //! returns the value key
+  bool getValueKey(uint64_t &key) const override
+  {
+    key=uint64_t(m_value);
+    return true;
+  }
 protected:
   //! copy constructor
   StarAttributeUInt(StarAttributeUInt const &) = default;
@@ -1009,6 +1106,12 @@ public:
     if (m_value!=STOFFVec2i(0,0)) o << "=" << m_value;
     o << ",";
   }
+  //! returns the value key
+  bool getValueKey(uint64_t &key) const override
+  {
+    key=(uint64_t(uint32_t(m_value[0]))<<32) | uint64_t(uint32_t(m_value[1]));
+    return true;
+  }
 
 protected:
   //! copy constructor
@@ -1038,13 +1141,13 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) override;
   //! debug function to print the data
-  void print(libstoff::DebugStream &o, std::set<StarAttribute const *> &done) const override;
+  void print(libstoff::DebugStream &o, StarAttributeDoneSet &done) const override;
 
 protected:
   //! add to a state
-  void addTo(StarState &state, std::set<StarAttribute const *> &done) const override;
+  void addTo(StarState &state, StarAttributeDoneSet &done) const override;
   //! try to send the sone data
-  bool send(STOFFListenerPtr &listener, StarState &state, std::set<StarAttribute const *> &done) const override;
+  bool send(STOFFListenerPtr &listener, StarState &state, StarAttributeDoneSet &done) const override;
 
   //! copy constructor
   StarAttributeItemSet(StarAttributeItemSet const &) = default;
@@ -1070,6 +1173,12 @@ public:
   }
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) override;
+  //! returns the value key
+  bool getValueKey(uint64_t &key) const override
+  {
+    key=0;
+    return true;
+  }
 };
 
 /** \brief the main class to read/.. a StarOffice attribute
@@ -1094,12 +1203,24 @@ public:
   static std::shared_ptr<StarAttribute> getDummyAttribute(int type=-1);
 
 protected:
+  //! try to return an attribute equal to a simple attribute, store it if it is new
+  std::shared_ptr<StarAttribute> getSharedAttribute(int which, std::shared_ptr<StarAttribute> const &attribute);
+  //! small struct used to hash a pair which, value key
+  struct ValueKeyHash {
+    //! the hash function
+    size_t operator()(std::pair<int, uint64_t> const &key) const
+    {
+      return std::hash<uint64_t>()(key.second*0x9e3779b97f4a7c15ULL ^ uint64_t(key.first));
+    }
+  };
   //
   // data
   //
+  //! the map which, value key to the simple attributes already created (shared by all the objects of a document)
+  std::unordered_map<std::pair<int, uint64_t>, std::shared_ptr<StarAttribute>, ValueKeyHash> m_valueKeyToAttributeMap;
 private:
-  //! the state
-  std::shared_ptr<StarAttributeInternal::State> m_state;
+  //! the state: the process-wide list of attribute prototypes
+  StarAttributeInternal::State const &m_state;
 };
 #endif
 // vim: set filetype=cpp tabstop=2 shiftwidth=2 cindent autoindent smartindent noexpandtab:
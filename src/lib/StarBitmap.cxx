@@ -76,44 +76,109 @@ struct Bitmap {
     m_pixelsPerMeter[0]=m_pixelsPerMeter[1]=0;
     m_numColors[0]=m_numColors[1]=0;
   }
-  //! try to return a ppm data (without alpha)
-  bool getPPMData(librevenge::RVNGBinaryData &data) const
+  //! try to return the rgb data of each pixel (without alpha)
+  bool getRGBData(std::vector<unsigned char> &data) const
   {
     if (!m_width || !m_height || ((m_colorsList.empty() || m_indexDataList.empty()) && m_colorDataList.empty()))
       return false;
     data.clear();
-    std::stringstream f;
-    f << "P6\n" << m_width << " " << m_height << " 255\n";
-    auto const header = f.str();
-    data.append(reinterpret_cast<const unsigned char *>(header.c_str()), header.size());
     if (!m_colorDataList.empty()) {
       if (m_colorDataList.size()!=size_t(m_width*m_height)) {
-        STOFF_DEBUG_MSG(("StarBitmapInternal::Bitmap::getPPMData: color data list's size is bad\n"));
+        STOFF_DEBUG_MSG(("StarBitmapInternal::Bitmap::getRGBData: color data list's size is bad\n"));
         return false;
       }
+      data.reserve(3*m_colorDataList.size());
       for (auto const &c : m_colorDataList) {
         uint32_t col=c.value();
         for (int comp=0, depl=16; comp<3; ++comp, depl-=8)
-          data.append(static_cast<unsigned char>((col>>depl)&0xFF));
+          data.push_back(static_cast<unsigned char>((col>>depl)&0xFF));
       }
       return true;
     }
     if (m_indexDataList.size()/m_width!=m_height || m_indexDataList.size()%m_width!=0) {
-      STOFF_DEBUG_MSG(("StarBitmapInternal::Bitmap::getPPMData: index data list's size is bad\n"));
+      STOFF_DEBUG_MSG(("StarBitmapInternal::Bitmap::getRGBData: index data list's size is bad\n"));
       return false;
     }
     auto numColors=int(m_colorsList.size());
+    data.reserve(3*m_indexDataList.size());
     for (auto const &index : m_indexDataList) {
       if (index<0 || index>=numColors) {
-        STOFF_DEBUG_MSG(("StarBitmapInternal::Bitmap::getPPMData: find bad index=%d\n", index));
+        STOFF_DEBUG_MSG(("StarBitmapInternal::Bitmap::getRGBData: find bad index=%d\n", index));
         return false;
       }
       uint32_t col=m_colorsList[size_t(index)].value();
       for (int comp=0, depl=16; comp<3; ++comp, depl-=8)
-        data.append(static_cast<unsigned char>((col>>depl)&0xFF));
+        data.push_back(static_cast<unsigned char>((col>>depl)&0xFF));
+    }
+    return true;
+  }
+  //! try to return a ppm data (without alpha)
+  bool getPPMData(librevenge::RVNGBinaryData &data) const
+  {
+    std::vector<unsigned char> rgbData;
+    if (!getRGBData(rgbData))
+      return false;
+    data.clear();
+    std::stringstream f;
+    f << "P6\n" << m_width << " " << m_height << " 255\n";
+    auto const header = f.str();
+    data.append(reinterpret_cast<const unsigned char *>(header.c_str()), header.size());
+    data.append(rgbData.data(), rgbData.size());
+    return true;
+  }
+#ifdef USE_ZIP
+  //! try to return a png data (without alpha)
+  bool getPNGData(librevenge::RVNGBinaryData &data) const
+  {
+    std::vector<unsigned char> rgbData;
+    if (!getRGBData(rgbData))
+      return false;
+    // each row begins with its filter type: 0 (none)
+    size_t const rowSize=3*size_t(m_width);
+    std::vector<unsigned char> rows;
+    rows.reserve(rgbData.size()+size_t(m_height));
+    for (size_t r=0; r<size_t(m_height); ++r) {
+      rows.push_back(0);
+      rows.insert(rows.end(), rgbData.begin()+long(r*rowSize), rgbData.begin()+long((r+1)*rowSize));
+    }
+    auto compressedSize=compressBound(uLong(rows.size()));
+    std::vector<unsigned char> compressed(static_cast<size_t>(compressedSize));
+    if (compress2(&compressed[0], &compressedSize, &rows[0], uLong(rows.size()), Z_DEFAULT_COMPRESSION)!=Z_OK) {
+      STOFF_DEBUG_MSG(("StarBitmapInternal::Bitmap::getPNGData: can not compress the data\n"));
+      return false;
     }
+    compressed.resize(size_t(compressedSize));
+
+    data.clear();
+    static unsigned char const signature[]= {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    data.append(signature, sizeof(signature));
+    unsigned char header[13]= {0};
+    for (int i=0, depl=24; i<4; ++i, depl-=8) {
+      header[i]=static_cast<unsigned char>((m_width>>depl)&0xFF);
+      header[4+i]=static_cast<unsigned char>((m_height>>depl)&0xFF);
+    }
+    header[8]=8; // bit depth
+    header[9]=2; // truecolor, the other fields: compression, filter and interlace methods are 0
+    appendPNGChunk("IHDR", header, sizeof(header), data);
+    appendPNGChunk("IDAT", compressed.data(), compressed.size(), data);
+    appendPNGChunk("IEND", nullptr, 0, data);
     return true;
   }
+  //! appends a png chunk: length, type, data and crc
+  static void appendPNGChunk(char const *type, unsigned char const *buffer, size_t len, librevenge::RVNGBinaryData &data)
+  {
+    for (int depl=24; depl>=0; depl-=8)
+      data.append(static_cast<unsigned char>((len>>depl)&0xFF));
+    data.append(reinterpret_cast<unsigned char const *>(type), 4);
+    auto crc=crc32(0, reinterpret_cast<Bytef const *>(type), 4);
+    if (len) {
+      data.append(buffer, len);
+      crc=crc32(crc, buffer, uInt(len));
+    }
+    for (int depl=24; depl>=0; depl-=8)
+      data.append(static_cast<unsigned char>((crc>>depl)&0xFF));
+  }
+#endif
 
   //! operator<<
   friend std::ostream &operator<<(std::ostream &o, Bitmap const &info)
@@ -206,6 +271,17 @@ bool StarBitmap::getData(librevenge::RVNGBinaryData &data, std::string &type) co
   return true;
 }
 
+bool StarBitmap::getPNGData(librevenge::RVNGBinaryData &data) const
+{
+#ifdef USE_ZIP
+  return m_state->m_bitmap.getPNGData(data);
+#else
+  (void) data;
+  STOFF_DEBUG_MSG(("StarBitmap::getPNGData: zlib is not available\n"));
+  return false;
+#endif
+}
+
 STOFFVec2i StarBitmap::getBitmapSize() const
 {
   return STOFFVec2i(int(m_state->m_bitmap.m_width), int(m_state->m_bitmap.m_height));
@@ -77,6 +77,8 @@ public:
   bool readBitmap(StarZone &zone, bool inFileHeader, long lastPos, librevenge::RVNGBinaryData &data, std::string &type);
   //! try to convert the read data in ppm
   bool getData(librevenge::RVNGBinaryData &data, std::string &type) const;
+  //! try to convert the read data in png (needs zlib)
+  bool getPNGData(librevenge::RVNGBinaryData &data) const;
   //! try to return the bitmap size (in point)
   STOFFVec2i getBitmapSize() const;
 protected:
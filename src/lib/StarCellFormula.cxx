@@ -359,11 +359,40 @@ bool Token::addToken(std::vector<std::vector<Token> > &stack, Token const &token
 }
 
 }
+////////////////////////////////////////////////////////////
+// template map
+////////////////////////////////////////////////////////////
+bool StarCellFormula::TemplateMap::TemplateCompare::operator()(Template const &t1, Template const &t2) const
+{
+  if (!t1 || !t2) return t1.get()<t2.get();
+  if (t1->size()!=t2->size()) return t1->size()<t2->size();
+  for (size_t i=0; i<t1->size(); ++i) {
+    int diff=(*t1)[i].cmp((*t2)[i]);
+    if (diff) return diff<0;
+  }
+  return false;
+}
+
+void StarCellFormula::TemplateMap::share(STOFFCellContent &content, STOFFVec2i const &cellPos)
+{
+  if (content.m_formula.empty())
+    return;
+  Template formulaTemplate(new std::vector<STOFFCellContent::FormulaInstruction>
+                           (STOFFCellContent::getFormulaTemplate(content.m_formula, cellPos)));
+  auto it=m_templateSet.find(formulaTemplate);
+  if (it!=m_templateSet.end())
+    formulaTemplate=*it;
+  else
+    m_templateSet.insert(formulaTemplate);
+  content.setFormulaTemplate(formulaTemplate, cellPos);
+}
+
 ////////////////////////////////////////////////////////////
 // main zone
 ////////////////////////////////////////////////////////////
 void StarCellFormula::updateFormula(STOFFCellContent &content, std::vector<librevenge::RVNGString> const &sheetNames, int sheetId)
 {
+  content.expandFormula();
   auto numNames=int(sheetNames.size());
   for (auto &form : content.m_formula) {
     if ((form.m_type!=STOFFCellContent::FormulaInstruction::F_Cell &&
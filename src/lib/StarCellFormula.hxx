@@ -38,6 +38,8 @@
 #ifndef STAR_CELL_FORMULA
 #  define STAR_CELL_FORMULA
 
+#include <memory>
+#include <set>
 #include <vector>
 
 #include "libstaroffice_internal.hxx"
@@ -57,6 +59,36 @@ struct Token;
 class StarCellFormula
 {
 public:
+  /** \brief a map used to share the formulas of a sheet which only
+      differ by a relative offset, for instance =A1*B1 copied down a
+      column.
+   */
+  class TemplateMap
+  {
+  public:
+    //! constructor
+    TemplateMap()
+      : m_templateSet()
+    {
+    }
+    /** try to replace the content's formula by a shared template anchored at cellPos */
+    void share(STOFFCellContent &content, STOFFVec2i const &cellPos);
+    //! returns the number of different templates
+    size_t size() const
+    {
+      return m_templateSet.size();
+    }
+  protected:
+    //! a shared formula template
+    typedef std::shared_ptr<std::vector<STOFFCellContent::FormulaInstruction> const> Template;
+    //! small structure used to compare two templates
+    struct TemplateCompare {
+      //! comparison function
+      bool operator()(Template const &t1, Template const &t2) const;
+    };
+    //! the set of templates
+    std::set<Template, TemplateCompare> m_templateSet;
+  };
   //! constructor
   StarCellFormula() {}
   //! destructor
@@ -65,7 +97,7 @@ public:
   static bool readSCFormula(StarZone &zone, STOFFCellContent &content, int version, long lastPos);
   //! try to read a formula(v3)
   static bool readSCFormula3(StarZone &zone, STOFFCellContent &content, int version, long lastPos);
-  //! update the different formula(knowing the list of sheet names and the cell's sheetId)
+  //! update the different formula(knowing the list of sheet names and the cell's sheetId), expands the shared template if needed
   static void updateFormula(STOFFCellContent &content, std::vector<librevenge::RVNGString> const &sheetNames, int cellSheetId);
 protected:
   //
@@ -65,7 +65,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarCAttributeBool(*this));
   }
   //! add to a font
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 
 protected:
   //! copy constructor
@@ -86,7 +86,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarCAttributeColor(*this));
   }
   //! add to a font
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 protected:
   //! copy constructor
   StarCAttributeColor(StarCAttributeColor const &) = default;
@@ -102,7 +102,7 @@ public:
   {
   }
   //! add to a font
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! create a new attribute
   std::shared_ptr<StarAttribute> create() const final
   {
@@ -128,7 +128,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarCAttributeUInt(*this));
   }
   //! add to a font
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 protected:
   //! copy constructor
   StarCAttributeUInt(StarCAttributeUInt const &) = default;
@@ -143,7 +143,7 @@ public:
   {
   }
   //! add to a font
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! create a new attribute
   std::shared_ptr<StarAttribute> create() const final
   {
@@ -180,67 +180,67 @@ inline void addAttributeVoid(std::map<int, std::shared_ptr<StarAttribute> > &map
   map[type]=std::shared_ptr<StarAttribute>(new StarCAttributeVoid(type,debugName));
 }
 
-void StarCAttributeBool::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarCAttributeBool::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_CHR_CONTOUR)
-    state.m_font.m_propertyList.insert("style:text-outline", m_value);
+    state.m_font->m_propertyList.insert("style:text-outline", m_value);
   else if (m_type==ATTR_CHR_SHADOWED)
-    state.m_font.m_propertyList.insert("fo:text-shadow", m_value ? "1pt 1pt" : "none");
+    state.m_font->m_propertyList.insert("fo:text-shadow", m_value ? "1pt 1pt" : "none");
   else if (m_type==ATTR_CHR_BLINK)
-    state.m_font.m_propertyList.insert("style:text-blinking", m_value);
+    state.m_font->m_propertyList.insert("style:text-blinking", m_value);
   else if (m_type==ATTR_CHR_WORDLINEMODE)  {
-    state.m_font.m_propertyList.insert("style:text-line-through-mode", m_value ? "skip-white-space" : "continuous");
-    state.m_font.m_propertyList.insert("style:text-underline-mode", m_value ? "skip-white-space" : "continuous");
+    state.m_font->m_propertyList.insert("style:text-line-through-mode", m_value ? "skip-white-space" : "continuous");
+    state.m_font->m_propertyList.insert("style:text-underline-mode", m_value ? "skip-white-space" : "continuous");
   }
   else if (m_type==ATTR_CHR_AUTOKERN)
-    state.m_font.m_propertyList.insert("style:letter-kerning", m_value);
+    state.m_font->m_propertyList.insert("style:letter-kerning", m_value);
   else if (m_type==ATTR_SC_HYPHENATE)
-    state.m_font.m_propertyList.insert("fo:hyphenate", m_value);
+    state.m_font->m_propertyList.insert("fo:hyphenate", m_value);
   else if (m_type==ATTR_CHR_NOHYPHEN)
-    state.m_font.m_hyphen=!m_value;
+    state.m_font->m_hyphen=!m_value;
   else if (m_type==ATTR_CHR_NOLINEBREAK)
-    state.m_font.m_lineBreak=!m_value;
+    state.m_font->m_lineBreak=!m_value;
 }
 
-void StarCAttributeColor::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarCAttributeColor::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_CHR_COLOR)
-    state.m_font.m_propertyList.insert("fo:color", m_value.str().c_str());
+    state.m_font->m_propertyList.insert("fo:color", m_value.str().c_str());
 }
 
-void StarCAttributeInt::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarCAttributeInt::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_CHR_KERNING)
-    state.m_font.m_propertyList.insert("fo:letter-spacing", m_value, librevenge::RVNG_TWIP);
+    state.m_font->m_propertyList.insert("fo:letter-spacing", m_value, librevenge::RVNG_TWIP);
 }
 
-void StarCAttributeUInt::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarCAttributeUInt::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_CHR_CROSSEDOUT) {
     switch (m_value) {
     case 0: // none
-      state.m_font.m_propertyList.insert("style:text-line-through-type", "none");
+      state.m_font->m_propertyList.insert("style:text-line-through-type", "none");
       break;
     case 1: // single
     case 2: // double
-      state.m_font.m_propertyList.insert("style:text-line-through-type", m_value==1 ? "single" : "double");
-      state.m_font.m_propertyList.insert("style:text-line-through-style", "solid");
+      state.m_font->m_propertyList.insert("style:text-line-through-type", m_value==1 ? "single" : "double");
+      state.m_font->m_propertyList.insert("style:text-line-through-style", "solid");
       break;
     case 3: // dontknow
       break;
     case 4: // bold
-      state.m_font.m_propertyList.insert("style:text-line-through-type", "single");
-      state.m_font.m_propertyList.insert("style:text-line-through-style", "solid");
-      state.m_font.m_propertyList.insert("style:text-line-through-width", "thick");
+      state.m_font->m_propertyList.insert("style:text-line-through-type", "single");
+      state.m_font->m_propertyList.insert("style:text-line-through-style", "solid");
+      state.m_font->m_propertyList.insert("style:text-line-through-width", "thick");
       break;
     case 5: // slash
     case 6: // X
-      state.m_font.m_propertyList.insert("style:text-line-through-type", "single");
-      state.m_font.m_propertyList.insert("style:text-line-through-style", "solid");
-      state.m_font.m_propertyList.insert("style:text-line-through-text", m_value==5 ? "/" : "X");
+      state.m_font->m_propertyList.insert("style:text-line-through-type", "single");
+      state.m_font->m_propertyList.insert("style:text-line-through-style", "solid");
+      state.m_font->m_propertyList.insert("style:text-line-through-text", m_value==5 ? "/" : "X");
       break;
     default:
-      state.m_font.m_propertyList.insert("style:text-line-through-type", "none");
+      state.m_font->m_propertyList.insert("style:text-line-through-type", "none");
       STOFF_DEBUG_MSG(("StarCharAttribute::StarCAttributeUInt: find unknown crossedout enum=%d\n", m_value));
       break;
     }
@@ -249,29 +249,29 @@ void StarCAttributeUInt::addTo(StarState &state, std::set<StarAttribute const *>
     switch (m_value) {
     case 0: // none
     case 4: // unknown
-      state.m_font.m_propertyList.insert("style:text-underline-type", "none");
+      state.m_font->m_propertyList.insert("style:text-underline-type", "none");
       break;
     case 1: // single
     case 2: // double
-      state.m_font.m_propertyList.insert("style:text-underline-type", m_value==1 ? "single" : "double");
-      state.m_font.m_propertyList.insert("style:text-underline-style", "solid");
+      state.m_font->m_propertyList.insert("style:text-underline-type", m_value==1 ? "single" : "double");
+      state.m_font->m_propertyList.insert("style:text-underline-style", "solid");
       break;
     case 3: // dot
     case 5: // dash
     case 6: // long-dash
     case 7: // dash-dot
     case 8: // dash-dot-dot
-      state.m_font.m_propertyList.insert("style:text-underline-type", "single");
-      state.m_font.m_propertyList.insert("style:text-underline-style", m_value==3 ? "dotted" : m_value==5 ? "dash" :
+      state.m_font->m_propertyList.insert("style:text-underline-type", "single");
+      state.m_font->m_propertyList.insert("style:text-underline-style", m_value==3 ? "dotted" : m_value==5 ? "dash" :
                                          m_value==6 ? "long-dash" : m_value==7 ? "dot-dash" : "dot-dot-dash");
       break;
     case 9: // small wave
     case 10: // wave
     case 11: // double wave
-      state.m_font.m_propertyList.insert("style:text-underline-type", m_value==11 ? "single" : "double");
-      state.m_font.m_propertyList.insert("style:text-underline-style", "wave");
+      state.m_font->m_propertyList.insert("style:text-underline-type", m_value==11 ? "single" : "double");
+      state.m_font->m_propertyList.insert("style:text-underline-style", "wave");
       if (m_value==9)
-        state.m_font.m_propertyList.insert("style:text-underline-width", "thin");
+        state.m_font->m_propertyList.insert("style:text-underline-width", "thin");
       break;
     case 12: // bold
     case 13: // bold dot
@@ -281,13 +281,13 @@ void StarCAttributeUInt::addTo(StarState &state, std::set<StarAttribute const *>
     case 17: // bold dash-dot-dot
     case 18: { // bold wave
       char const *wh[]= {"solid", "dotted", "dash", "long-dash", "dot-dash", "dot-dot-dash", "wave"};
-      state.m_font.m_propertyList.insert("style:text-underline-type", "single");
-      state.m_font.m_propertyList.insert("style:text-underline-style", wh[m_value-12]);
-      state.m_font.m_propertyList.insert("style:text-underline-width", "thick");
+      state.m_font->m_propertyList.insert("style:text-underline-type", "single");
+      state.m_font->m_propertyList.insert("style:text-underline-style", wh[m_value-12]);
+      state.m_font->m_propertyList.insert("style:text-underline-width", "thick");
       break;
     }
     default:
-      state.m_font.m_propertyList.insert("style:text-underline-type", "none");
+      state.m_font->m_propertyList.insert("style:text-underline-type", "none");
       STOFF_DEBUG_MSG(("StarCharAttribute::StarCAttributeUInt: find unknown underline enum=%d\n", m_value));
       break;
     }
@@ -295,49 +295,49 @@ void StarCAttributeUInt::addTo(StarState &state, std::set<StarAttribute const *>
   else if (m_type==ATTR_CHR_POSTURE || m_type==ATTR_CHR_CJK_POSTURE || m_type==ATTR_CHR_CTL_POSTURE) {
     std::string wh(m_type==ATTR_CHR_POSTURE ? "fo:font-style" :  m_type==ATTR_CHR_CJK_POSTURE ? "style:font-style-asian" : "style:font-style-complex");
     if (m_value==1)
-      state.m_font.m_propertyList.insert(wh.c_str(), "oblique");
+      state.m_font->m_propertyList.insert(wh.c_str(), "oblique");
     else if (m_value==2)
-      state.m_font.m_propertyList.insert(wh.c_str(), "italic");
+      state.m_font->m_propertyList.insert(wh.c_str(), "italic");
     else if (m_value) {
       STOFF_DEBUG_MSG(("StarCharAttribute::StarCAttributeUInt: find unknown posture enum=%d\n", m_value));
     }
   }
   else if (m_type==ATTR_CHR_RELIEF) {
     if (m_value==0)
-      state.m_font.m_propertyList.insert("style:font-relief", "none");
+      state.m_font->m_propertyList.insert("style:font-relief", "none");
     else if (m_value==1)
-      state.m_font.m_propertyList.insert("style:font-relief", "embossed");
+      state.m_font->m_propertyList.insert("style:font-relief", "embossed");
     else if (m_value==2)
-      state.m_font.m_propertyList.insert("style:font-relief", "engraved");
+      state.m_font->m_propertyList.insert("style:font-relief", "engraved");
     else if (m_value) {
-      state.m_font.m_propertyList.insert("style:font-relief", "none");
+      state.m_font->m_propertyList.insert("style:font-relief", "none");
       STOFF_DEBUG_MSG(("StarCharAttribute::StarCAttributeUInt: find unknown relief enum=%d\n", m_value));
     }
   }
   else if (m_type==ATTR_CHR_WEIGHT || m_type==ATTR_CHR_CJK_WEIGHT || m_type==ATTR_CHR_CTL_WEIGHT) {
     std::string wh(m_type==ATTR_CHR_WEIGHT ? "fo:font-weight" :  m_type==ATTR_CHR_CJK_WEIGHT ? "style:font-weight-asian" : "style:font-weight-complex");
     if (m_value==5)
-      state.m_font.m_propertyList.insert(wh.c_str(), "normal");
+      state.m_font->m_propertyList.insert(wh.c_str(), "normal");
     else if (m_value==8)
-      state.m_font.m_propertyList.insert(wh.c_str(), "bold");
+      state.m_font->m_propertyList.insert(wh.c_str(), "bold");
     else if (m_value>=1 && m_value<=9)
-      state.m_font.m_propertyList.insert(wh.c_str(), m_value*100, librevenge::RVNG_GENERIC);
+      state.m_font->m_propertyList.insert(wh.c_str(), m_value*100, librevenge::RVNG_GENERIC);
     else // 10: WEIGHT_BLACK
-      state.m_font.m_propertyList.insert(wh.c_str(), "normal");
+      state.m_font->m_propertyList.insert(wh.c_str(), "normal");
   }
   else if (m_type==ATTR_CHR_CASEMAP) {
     if (m_value==0)
-      state.m_font.m_propertyList.insert("fo:text-transform", "none");
+      state.m_font->m_propertyList.insert("fo:text-transform", "none");
     else if (m_value==1)
-      state.m_font.m_propertyList.insert("fo:text-transform", "uppercase");
+      state.m_font->m_propertyList.insert("fo:text-transform", "uppercase");
     else if (m_value==2)
-      state.m_font.m_propertyList.insert("fo:text-transform", "lowercase");
+      state.m_font->m_propertyList.insert("fo:text-transform", "lowercase");
     else if (m_value==3)
-      state.m_font.m_propertyList.insert("fo:text-transform", "capitalize");
+      state.m_font->m_propertyList.insert("fo:text-transform", "capitalize");
     else if (m_value==4)
-      state.m_font.m_propertyList.insert("fo:font-variant", "small-caps");
+      state.m_font->m_propertyList.insert("fo:font-variant", "small-caps");
     else if (m_value) {
-      state.m_font.m_propertyList.insert("fo:text-transform", "none");
+      state.m_font->m_propertyList.insert("fo:text-transform", "none");
       STOFF_DEBUG_MSG(("StarCharAttribute::StarCAttributeUInt: find unknown casemap enum=%d\n", m_value));
     }
   }
@@ -348,35 +348,35 @@ void StarCAttributeUInt::addTo(StarState &state, std::set<StarAttribute const *>
     std::string lang, country;
     if (StarLanguage::getLanguageId(int(m_value), lang, country)) {
       if (!lang.empty())
-        state.m_font.m_propertyList.insert((prefix + "language" + extension).c_str(), lang.c_str());
+        state.m_font->m_propertyList.insert((prefix + "language" + extension).c_str(), lang.c_str());
       if (!country.empty())
-        state.m_font.m_propertyList.insert((prefix + "country" + extension).c_str(), country.c_str());
+        state.m_font->m_propertyList.insert((prefix + "country" + extension).c_str(), country.c_str());
     }
   }
   else if (m_type==ATTR_CHR_PROPORTIONALFONTSIZE && m_value!=100) // checkme: maybe font-size with %
-    state.m_font.m_propertyList.insert("style:text-scale", double(m_value)/100., librevenge::RVNG_PERCENT);
+    state.m_font->m_propertyList.insert("style:text-scale", double(m_value)/100., librevenge::RVNG_PERCENT);
   else if (m_type==ATTR_CHR_EMPHASIS_MARK) {
     if (m_value && ((m_value&0xC000)==0 || (m_value&0x3000)==0x3000 || (m_value&0xFFF)>4 || (m_value&0xFFF)==0)) {
-      state.m_font.m_propertyList.insert("style:text-emphasize", "none");
+      state.m_font->m_propertyList.insert("style:text-emphasize", "none");
       STOFF_DEBUG_MSG(("StarCharAttribute::StarCAttributeUInt: find unknown emphasis mark=%x\n", unsigned(m_value)));
     }
     else if (m_value) {
       std::string what((m_value&7)== 1 ? "dot" : (m_value&7)== 2 ? "circle" : (m_value&7)== 3 ? "disc" : "accent");
-      state.m_font.m_propertyList.insert("style:text-emphasize", (what+((m_value&0x1000) ? " above" : " below")).c_str());
+      state.m_font->m_propertyList.insert("style:text-emphasize", (what+((m_value&0x1000) ? " above" : " below")).c_str());
     }
     else
-      state.m_font.m_propertyList.insert("style:text-emphasize", "none");
+      state.m_font->m_propertyList.insert("style:text-emphasize", "none");
   }
 }
 
-void StarCAttributeVoid::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarCAttributeVoid::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_TXT_SOFTHYPH)
-    state.m_font.m_softHyphen=true;
+    state.m_font->m_softHyphen=true;
   else if (m_type==ATTR_EE_FEATURE_TAB)
-    state.m_font.m_tab=true;
+    state.m_font->m_tab=true;
   else if (m_type==ATTR_EE_FEATURE_LINEBR)
-    state.m_font.m_lineBreak=true;
+    state.m_font->m_lineBreak=true;
 }
 
 }
@@ -446,7 +446,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a font
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -481,7 +481,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a font
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -565,7 +565,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a font
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -620,7 +620,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a font
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 protected:
   //! copy constructor
   StarCAttributeCharFormat(StarCAttributeCharFormat const &) = default;
@@ -646,7 +646,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a font
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -655,7 +655,7 @@ public:
     o << "],";
   }
   //! add to send the zone data
-  bool send(STOFFListenerPtr &listener, StarState &state, std::set<StarAttribute const *> &done) const final;
+  bool send(STOFFListenerPtr &listener, StarState &state, StarAttributeDoneSet &done) const final;
 protected:
   //! copy constructor
   StarCAttributeContent(StarCAttributeContent const &) = default;
@@ -681,7 +681,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a font
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 protected:
   //! copy constructor
   StarCAttributeField(StarCAttributeField const &) = default;
@@ -705,7 +705,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarCAttributeFlyCnt(*this));
   }
   //! add to the state
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! debug function to print the data
@@ -714,7 +714,7 @@ public:
     o << m_debugName << ",";
   }
   //! add to send the zone data
-  bool send(STOFFListenerPtr &listener, StarState &state, std::set<StarAttribute const *> &done) const final;
+  bool send(STOFFListenerPtr &listener, StarState &state, StarAttributeDoneSet &done) const final;
 protected:
   //! copy constructor
   StarCAttributeFlyCnt(StarCAttributeFlyCnt const &) = default;
@@ -744,7 +744,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a font
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -757,7 +757,7 @@ public:
     o << "],";
   }
   //! add to send the zone data
-  bool send(STOFFListenerPtr &listener, StarState &state, std::set<StarAttribute const *> &done) const final;
+  bool send(STOFFListenerPtr &listener, StarState &state, StarAttributeDoneSet &done) const final;
 protected:
   //! copy constructor
   StarCAttributeFootnote(StarCAttributeFootnote const &) = default;
@@ -790,7 +790,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a font
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -827,7 +827,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a font
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -880,7 +880,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a font
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -895,35 +895,35 @@ protected:
   librevenge::RVNGString m_name;
 };
 
-void StarCAttributeEscapement::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarCAttributeEscapement::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   std::stringstream s;
   s << m_delta << "% " << m_scale << "%";
-  state.m_font.m_propertyList.insert("style:text-position", s.str().c_str());
+  state.m_font->m_propertyList.insert("style:text-position", s.str().c_str());
 }
 
-void StarCAttributeFont::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarCAttributeFont::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (!m_name.empty()) {
     if (m_type==ATTR_CHR_FONT)
-      state.m_font.m_propertyList.insert("style:font-name", m_name);
+      state.m_font->m_propertyList.insert("style:font-name", m_name);
     else if (m_type==ATTR_CHR_CJK_FONT)
-      state.m_font.m_propertyList.insert("style:font-name-asian", m_name);
+      state.m_font->m_propertyList.insert("style:font-name-asian", m_name);
     else if (m_type==ATTR_CHR_CTL_FONT)
-      state.m_font.m_propertyList.insert("style:font-name-complex", m_name);
+      state.m_font->m_propertyList.insert("style:font-name-complex", m_name);
   }
   if (m_pitch==1 || m_pitch==2) {
     if (m_type==ATTR_CHR_FONT)
-      state.m_font.m_propertyList.insert("style:font-pitch", m_pitch==1 ? "fixed" : "variable");
+      state.m_font->m_propertyList.insert("style:font-pitch", m_pitch==1 ? "fixed" : "variable");
     else if (m_type==ATTR_CHR_CJK_FONT)
-      state.m_font.m_propertyList.insert("style:font-pitch-asian", m_pitch==1 ? "fixed" : "variable");
+      state.m_font->m_propertyList.insert("style:font-pitch-asian", m_pitch==1 ? "fixed" : "variable");
     else if (m_type==ATTR_CHR_CTL_FONT)
-      state.m_font.m_propertyList.insert("style:font-pitch-complex", m_pitch==1 ? "fixed" : "variable");
+      state.m_font->m_propertyList.insert("style:font-pitch-complex", m_pitch==1 ? "fixed" : "variable");
   }
   // TODO m_style, m_family
 }
 
-void StarCAttributeFontSize::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarCAttributeFontSize::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   std::string wh(m_type==ATTR_CHR_FONTSIZE ? "fo:font-size" :
                  m_type==ATTR_CHR_CJK_FONTSIZE ? "style:font-size-asian" :
@@ -934,50 +934,50 @@ void StarCAttributeFontSize::addTo(StarState &state, std::set<StarAttribute cons
   // TODO: use m_proportion?
   switch (m_unit) {
   case 0:
-    state.m_font.m_propertyList.insert(wh.c_str(), double(m_size)*0.02756, librevenge::RVNG_POINT);
+    state.m_font->m_propertyList.insert(wh.c_str(), double(m_size)*0.02756, librevenge::RVNG_POINT);
     break;
   case 1:
-    state.m_font.m_propertyList.insert(wh.c_str(), double(m_size)*0.2756, librevenge::RVNG_POINT);
+    state.m_font->m_propertyList.insert(wh.c_str(), double(m_size)*0.2756, librevenge::RVNG_POINT);
     break;
   case 2:
-    state.m_font.m_propertyList.insert(wh.c_str(), double(m_size)*2.756, librevenge::RVNG_POINT);
+    state.m_font->m_propertyList.insert(wh.c_str(), double(m_size)*2.756, librevenge::RVNG_POINT);
     break;
   case 3:
-    state.m_font.m_propertyList.insert(wh.c_str(), double(m_size)*27.56, librevenge::RVNG_POINT);
+    state.m_font->m_propertyList.insert(wh.c_str(), double(m_size)*27.56, librevenge::RVNG_POINT);
     break;
   case 4:
-    state.m_font.m_propertyList.insert(wh.c_str(), double(m_size)/1000., librevenge::RVNG_INCH);
+    state.m_font->m_propertyList.insert(wh.c_str(), double(m_size)/1000., librevenge::RVNG_INCH);
     break;
   case 5:
-    state.m_font.m_propertyList.insert(wh.c_str(), double(m_size)/100., librevenge::RVNG_INCH);
+    state.m_font->m_propertyList.insert(wh.c_str(), double(m_size)/100., librevenge::RVNG_INCH);
     break;
   case 6:
-    state.m_font.m_propertyList.insert(wh.c_str(), double(m_size)/10., librevenge::RVNG_INCH);
+    state.m_font->m_propertyList.insert(wh.c_str(), double(m_size)/10., librevenge::RVNG_INCH);
     break;
   case 7:
-    state.m_font.m_propertyList.insert(wh.c_str(), double(m_size), librevenge::RVNG_INCH);
+    state.m_font->m_propertyList.insert(wh.c_str(), double(m_size), librevenge::RVNG_INCH);
     break;
   case 8:
-    state.m_font.m_propertyList.insert(wh.c_str(), double(m_size), librevenge::RVNG_POINT);
+    state.m_font->m_propertyList.insert(wh.c_str(), double(m_size), librevenge::RVNG_POINT);
     break;
   case 9: // TWIP
-    state.m_font.m_propertyList.insert(wh.c_str(), double(m_size)/20., librevenge::RVNG_POINT);
+    state.m_font->m_propertyList.insert(wh.c_str(), double(m_size)/20., librevenge::RVNG_POINT);
     break;
   case 10: // pixel
-    state.m_font.m_propertyList.insert(wh.c_str(), double(m_size), librevenge::RVNG_POINT);
+    state.m_font->m_propertyList.insert(wh.c_str(), double(m_size), librevenge::RVNG_POINT);
     break;
   case 13: // rel, checkme
-    state.m_font.m_propertyList.insert(wh.c_str(), double(m_size)*state.m_global->m_relativeUnit, librevenge::RVNG_POINT);
+    state.m_font->m_propertyList.insert(wh.c_str(), double(m_size)*state.m_global->m_relativeUnit, librevenge::RVNG_POINT);
     break;
   default: // checkme
-    state.m_font.m_propertyList.insert(wh.c_str(), double(m_size)/20., librevenge::RVNG_POINT);
+    state.m_font->m_propertyList.insert(wh.c_str(), double(m_size)/20., librevenge::RVNG_POINT);
     break;
   }
 }
 
-void StarCAttributeCharFormat::addTo(StarState &state, std::set<StarAttribute const *> &done) const
+void StarCAttributeCharFormat::addTo(StarState &state, StarAttributeDoneSet &done) const
 {
-  if (done.find(this) != done.end())
+  if (done.contains(this))
     return;
   done.insert(this);
   if (m_type==ATTR_TXT_CHARFMT) {
@@ -986,8 +986,7 @@ void StarCAttributeCharFormat::addTo(StarState &state, std::set<StarAttribute co
     if (style) {
       state.m_font=STOFFFont();
       StarItemSet const &itemSet=style->m_itemSet;
-      std::map<int, std::shared_ptr<StarItem> >::const_iterator it;
-      for (it=itemSet.m_whichToItemMap.begin(); it!=itemSet.m_whichToItemMap.end(); ++it) {
+      for (auto it=itemSet.m_whichToItemMap.begin(); it!=itemSet.m_whichToItemMap.end(); ++it) {
         if (it->second && it->second->m_attribute)
           it->second->m_attribute->addTo(state, done);
       }
@@ -996,32 +995,32 @@ void StarCAttributeCharFormat::addTo(StarState &state, std::set<StarAttribute co
   }
 }
 
-void StarCAttributeContent::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarCAttributeContent::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   state.m_content=true;
 }
 
-void StarCAttributeField::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarCAttributeField::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   state.m_field=m_field;
 }
 
-void StarCAttributeFlyCnt::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarCAttributeFlyCnt::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   state.m_flyCnt=true;
 }
 
-void StarCAttributeFootnote::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarCAttributeFootnote::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   state.m_footnote=true;
 }
 
-void StarCAttributeHardBlank::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarCAttributeHardBlank::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
-  state.m_font.m_hardBlank=true;
+  state.m_font->m_hardBlank=true;
 }
 
-void StarCAttributeINetFmt::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarCAttributeINetFmt::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_url.empty()) {
     STOFF_DEBUG_MSG(("StarCAttributeINetFmt::addTo: can not find the url\n"));
@@ -1030,7 +1029,7 @@ void StarCAttributeINetFmt::addTo(StarState &state, std::set<StarAttribute const
   state.m_link=m_url;
 }
 
-void StarCAttributeRefMark::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarCAttributeRefMark::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   state.m_refMark=m_name;
 }
@@ -1368,9 +1367,9 @@ bool StarCAttributeRefMark::read(StarZone &zone, int /*nVers*/, long endPos, Sta
   return input->tell()<=endPos;
 }
 
-bool StarCAttributeContent::send(STOFFListenerPtr &listener, StarState &state, std::set<StarAttribute const *> &done) const
+bool StarCAttributeContent::send(STOFFListenerPtr &listener, StarState &state, StarAttributeDoneSet &done) const
 {
-  if (done.find(this)!=done.end()) {
+  if (done.contains(this)) {
     STOFF_DEBUG_MSG(("StarCAttributeContent::send: find a loop\n"));
     return false;
   }
@@ -1384,9 +1383,9 @@ bool StarCAttributeContent::send(STOFFListenerPtr &listener, StarState &state, s
   return true;
 }
 
-bool StarCAttributeFlyCnt::send(STOFFListenerPtr &listener, StarState &state, std::set<StarAttribute const *> &done) const
+bool StarCAttributeFlyCnt::send(STOFFListenerPtr &listener, StarState &state, StarAttributeDoneSet &done) const
 {
-  if (done.find(this)!=done.end()) {
+  if (done.contains(this)) {
     STOFF_DEBUG_MSG(("StarCAttributeFlyCnt::send: find a loop\n"));
     return false;
   }
@@ -1402,9 +1401,9 @@ bool StarCAttributeFlyCnt::send(STOFFListenerPtr &listener, StarState &state, st
   return m_format->send(listener, state);
 }
 
-bool StarCAttributeFootnote::send(STOFFListenerPtr &listener, StarState &state, std::set<StarAttribute const *> &done) const
+bool StarCAttributeFootnote::send(STOFFListenerPtr &listener, StarState &state, StarAttributeDoneSet &done) const
 {
-  if (done.find(this)!=done.end()) {
+  if (done.contains(this)) {
     STOFF_DEBUG_MSG(("StarCAttributeFootnote::send: find a loop\n"));
     return false;
   }
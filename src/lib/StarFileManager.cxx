@@ -956,8 +956,10 @@ bool StarFileManager::readJobSetUp(StarZone &zone, bool useJobLen)
   return true;
 }
 
-bool StarFileManager::readSVGDI(StarZone &zone)
+bool StarFileManager::readSVGDI(StarZone &zone, librevenge::RVNGBinaryData *image, std::string *imageType)
 {
+  if (image) image->clear();
+  if (imageType) imageType->clear();
   STOFFInputStreamPtr input=zone.input();
   libstoff::DebugFile &ascFile=zone.ascii();
   long pos=input->tell();
@@ -1205,6 +1207,12 @@ bool StarFileManager::readSVGDI(StarZone &zone)
       std::string dataType;
       if (!bitmap.readBitmap(zone, false, endDataPos, data, dataType))
         f << "###bitmap,";
+      else if (image && imageType && image->empty()) {
+        if (bitmap.getPNGData(*image))
+          *imageType="image/png";
+        else if (!bitmap.getData(*image, *imageType))
+          image->clear();
+      }
       break;
     }
     case 19:
@@ -93,8 +93,9 @@ public:
   static bool readJobSetUp(StarZone &zone, bool usePrinterLen);
   //! try to read a font
   static bool readFont(StarZone &zone);
-  //! try to read a SVGDI object
-  static bool readSVGDI(StarZone &zone);
+  /** try to read a SVGDI object, if image is set, retrieves its first bitmap:
+      a png picture if possible or a ppm picture */
+  static bool readSVGDI(StarZone &zone, librevenge::RVNGBinaryData *image=nullptr, std::string *imageType=nullptr);
 
 protected:
 
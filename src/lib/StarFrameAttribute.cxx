@@ -60,7 +60,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarFAttributeBool(*this));
   }
   //! add to a frame style
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 
 protected:
   //! copy constructor
@@ -84,7 +84,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarFAttributeColor(*this));
   }
   //! add to a frame style
-  // void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  // void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 protected:
   //! copy constructor
   StarFAttributeColor(StarFAttributeColor const &) = default;
@@ -103,7 +103,7 @@ public:
   {
   }
   //! add to a frame style
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! create a new attribute
   std::shared_ptr<StarAttribute> create() const final
   {
@@ -147,7 +147,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarFAttributeUInt(*this));
   }
   //! add to a frame style
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 protected:
   //! copy constructor
   StarFAttributeUInt(StarFAttributeUInt const &) = default;
@@ -170,7 +170,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarFAttributeVoid(*this));
   }
   //! add to a frame style
-  // void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  // void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 protected:
   //! copy constructor
   StarFAttributeVoid(StarFAttributeVoid const &) = default;
@@ -180,17 +180,17 @@ StarFAttributeVoid::~StarFAttributeVoid()
 {
 }
 
-void StarFAttributeBool::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarFAttributeBool::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_FRM_LAYOUT_SPLIT)
-    state.m_frame.m_propertyList.insert("style:may-break-between-rows", m_value);
+    state.m_frame->m_propertyList.insert("style:may-break-between-rows", m_value);
 }
 
-void StarFAttributeInt::addTo(StarState &/*state*/, std::set<StarAttribute const *> &/*done*/) const
+void StarFAttributeInt::addTo(StarState &/*state*/, StarAttributeDoneSet &/*done*/) const
 {
 }
 
-void StarFAttributeUInt::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarFAttributeUInt::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_FRM_BREAK) {
     if (m_value>0 && m_value<=6) state.m_break=int(m_value);
@@ -249,7 +249,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a cell/graphic/paragraph style
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -287,7 +287,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a cell/graphic/paragraph style
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -342,7 +342,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a cell/font/graphic style
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -377,7 +377,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a page
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -425,7 +425,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a para
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -465,7 +465,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a paragraph/page
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -515,7 +515,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a cell style
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -566,7 +566,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a cell/graphic style
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -616,7 +616,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a cell/graphic style
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -658,7 +658,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a page/paragraph
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -681,7 +681,7 @@ protected:
   int m_propMargins[2];
 };
 
-void StarFAttributeAnchor::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarFAttributeAnchor::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   /* FLY_AT_PARA, FLY_AS_CHAR, FLY_AT_PAGE, FLY_AT_FLY, FLY_AT_CHAR
      RND_STD_HEADER, RND_STD_FOOTER, RND_STD_HEADERL, RND_STD_HEADERR,
@@ -689,30 +689,30 @@ void StarFAttributeAnchor::addTo(StarState &state, std::set<StarAttribute const
      RND_DRAW_OBJECT   */
   STOFFPosition::AnchorTo const wh[]= {STOFFPosition::Paragraph, STOFFPosition::CharBaseLine,  STOFFPosition::Page, STOFFPosition::Frame, STOFFPosition::Char };
   if (m_anchor>=0 && m_anchor < int(STOFF_N_ELEMENTS(wh))) {
-    state.m_frame.m_position.setAnchor(wh[m_anchor]);
+    state.m_frame->m_position.setAnchor(wh[m_anchor]);
     char const *defaultXRel[] = {"paragraph", "paragraph", "page", "frame", "paragraph" };
     char const *defaultYRel[] = {"paragraph", "baseline", "page", "frame", "paragraph" };
     char const *defaultYPos[] = {nullptr, "bottom", nullptr, nullptr, "from-top"};
-    if (!state.m_frame.m_propertyList["style:horizontal-rel"] && defaultXRel[m_anchor])
-      state.m_frame.m_propertyList.insert("style:horizontal-rel",  defaultXRel[m_anchor]);
-    if (!state.m_frame.m_propertyList["style:vertical-rel"] && defaultYRel[m_anchor])
-      state.m_frame.m_propertyList.insert("style:vertical-rel",  defaultYRel[m_anchor]);
-    if (!state.m_frame.m_propertyList["style:vertical-pos"] && defaultYPos[m_anchor])
-      state.m_frame.m_propertyList.insert("style:vertical-pos",  defaultYPos[m_anchor]);
+    if (!state.m_frame->m_propertyList["style:horizontal-rel"] && defaultXRel[m_anchor])
+      state.m_frame->m_propertyList.insert("style:horizontal-rel",  defaultXRel[m_anchor]);
+    if (!state.m_frame->m_propertyList["style:vertical-rel"] && defaultYRel[m_anchor])
+      state.m_frame->m_propertyList.insert("style:vertical-rel",  defaultYRel[m_anchor]);
+    if (!state.m_frame->m_propertyList["style:vertical-pos"] && defaultYPos[m_anchor])
+      state.m_frame->m_propertyList.insert("style:vertical-pos",  defaultYPos[m_anchor]);
 
     if (m_anchor==2) { // page
       if (m_index>=0)
-        state.m_frame.m_propertyList.insert("text:anchor-page-number", m_index);
+        state.m_frame->m_propertyList.insert("text:anchor-page-number", m_index);
     }
     else if (m_anchor==4) // at char
-      state.m_frame.m_anchorIndex = m_index;
+      state.m_frame->m_anchorIndex = m_index;
   }
   else if (m_anchor>=0) {
     STOFF_DEBUG_MSG(("StarFrameAttributeInternal::StarFAttributeAnchor::addTo: unsure how to send anchor=%d\n", m_anchor));
   }
 }
 
-void StarFAttributeBorder::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarFAttributeBorder::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   char const *wh[] = {"top", "left", "right", "bottom"};
   if (m_type==ATTR_FRM_BOX) {
@@ -721,37 +721,37 @@ void StarFAttributeBorder::addTo(StarState &state, std::set<StarAttribute const
     // graphic
     for (int i=0; i<4; ++i) {
       if (!m_borders[i].isEmpty())
-        m_borders[i].addTo(state.m_graphic.m_propertyList, wh[i]);
+        m_borders[i].addTo(state.m_graphic->m_propertyList, wh[i]);
     }
     for (int i=0; i<4; ++i)
-      state.m_graphic.m_propertyList.insert((std::string("padding-")+wh[i]).c_str(), state.convertInPoint(m_distances[i]), librevenge::RVNG_POINT);
+      state.m_graphic->m_propertyList.insert((std::string("padding-")+wh[i]).c_str(), state.convertInPoint(m_distances[i]), librevenge::RVNG_POINT);
 
     // paragraph
     for (int i=0; i<4; ++i)
-      m_borders[i].addTo(state.m_paragraph.m_propertyList, wh[i]);
+      m_borders[i].addTo(state.m_paragraph->m_propertyList, wh[i]);
     // SW table
     for (int i=0; i<4; ++i)
-      m_borders[i].addTo(state.m_cell.m_propertyList, wh[i]);
+      m_borders[i].addTo(state.m_cell->m_propertyList, wh[i]);
   }
   else if (m_type==ATTR_SC_BORDER) {
     // checkme what is m_distance?
     for (int i=0; i<4; ++i)
-      m_borders[i].addTo(state.m_cell.m_propertyList, wh[i]);
+      m_borders[i].addTo(state.m_cell->m_propertyList, wh[i]);
   }
 }
 
-void StarFAttributeBrush::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarFAttributeBrush::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   // font
   if (m_type == ATTR_CHR_BACKGROUND) {
     if (m_brush.isEmpty())
-      state.m_font.m_propertyList.insert("fo:background-color", "transparent");
+      state.m_font->m_propertyList.insert("fo:background-color", "transparent");
     else {
       STOFFColor color;
       if (m_brush.getColor(color))
-        state.m_font.m_propertyList.insert("fo:background-color", color.str().c_str());
+        state.m_font->m_propertyList.insert("fo:background-color", color.str().c_str());
       else {
-        state.m_font.m_propertyList.insert("fo:background-color", "transparent");
+        state.m_font->m_propertyList.insert("fo:background-color", "transparent");
         STOFF_DEBUG_MSG(("StarFrameAttribute::StarFAttributeBrush::addTo: can not set a font background\n"));
       }
     }
@@ -759,78 +759,78 @@ void StarFAttributeBrush::addTo(StarState &state, std::set<StarAttribute const *
   // graphic|para
   else if (m_type==ATTR_FRM_BACKGROUND) {
     if (m_brush.m_transparency>0 && m_brush.m_transparency<=255)
-      state.m_graphic.m_propertyList.insert("draw:opacity", 1.-double(m_brush.m_transparency)/255., librevenge::RVNG_PERCENT);
+      state.m_graphic->m_propertyList.insert("draw:opacity", 1.-double(m_brush.m_transparency)/255., librevenge::RVNG_PERCENT);
     else
-      state.m_graphic.m_propertyList.insert("draw:opacity",1., librevenge::RVNG_PERCENT);
-    state.m_paragraph.m_propertyList.insert("fo:background-color", "transparent");
+      state.m_graphic->m_propertyList.insert("draw:opacity",1., librevenge::RVNG_PERCENT);
+    state.m_paragraph->m_propertyList.insert("fo:background-color", "transparent");
     // graphic
     if (m_brush.isEmpty())
-      state.m_graphic.m_propertyList.insert("draw:fill", "none");
+      state.m_graphic->m_propertyList.insert("draw:fill", "none");
     else {
       STOFFColor color;
       if (m_brush.hasUniqueColor() && m_brush.getColor(color)) {
-        state.m_graphic.m_propertyList.insert("draw:fill", "solid");
-        state.m_graphic.m_propertyList.insert("draw:fill-color", color.str().c_str());
+        state.m_graphic->m_propertyList.insert("draw:fill", "solid");
+        state.m_graphic->m_propertyList.insert("draw:fill-color", color.str().c_str());
 
         // para
-        state.m_paragraph.m_propertyList.insert("fo:background-color", color.str().c_str());
+        state.m_paragraph->m_propertyList.insert("fo:background-color", color.str().c_str());
       }
       else {
         STOFFEmbeddedObject object;
         STOFFVec2i size;
         if (m_brush.getPattern(object, size) && object.m_dataList.size()) {
-          state.m_graphic.m_propertyList.insert("draw:fill", "bitmap");
-          state.m_graphic.m_propertyList.insert("draw:fill-image", object.m_dataList[0].getBase64Data());
-          state.m_graphic.m_propertyList.insert("draw:fill-image-width", size[0], librevenge::RVNG_POINT);
-          state.m_graphic.m_propertyList.insert("draw:fill-image-height", size[1], librevenge::RVNG_POINT);
-          state.m_graphic.m_propertyList.insert("draw:fill-image-ref-point-x",0, librevenge::RVNG_POINT);
-          state.m_graphic.m_propertyList.insert("draw:fill-image-ref-point-y",0, librevenge::RVNG_POINT);
-          state.m_graphic.m_propertyList.insert("librevenge:mime-type", object.m_typeList.empty() ? "image/pict" : object.m_typeList[0].c_str());
+          state.m_graphic->m_propertyList.insert("draw:fill", "bitmap");
+          state.m_graphic->m_propertyList.insert("draw:fill-image", object.m_dataList[0].getBase64Data());
+          state.m_graphic->m_propertyList.insert("draw:fill-image-width", size[0], librevenge::RVNG_POINT);
+          state.m_graphic->m_propertyList.insert("draw:fill-image-height", size[1], librevenge::RVNG_POINT);
+          state.m_graphic->m_propertyList.insert("draw:fill-image-ref-point-x",0, librevenge::RVNG_POINT);
+          state.m_graphic->m_propertyList.insert("draw:fill-image-ref-point-y",0, librevenge::RVNG_POINT);
+          state.m_graphic->m_propertyList.insert("librevenge:mime-type", object.m_typeList.empty() ? "image/pict" : object.m_typeList[0].c_str());
         }
         else
-          state.m_graphic.m_propertyList.insert("draw:fill", "none");
+          state.m_graphic->m_propertyList.insert("draw:fill", "none");
       }
     }
     // SW table
     if (m_brush.isEmpty())
-      state.m_cell.m_propertyList.insert("fo:background-color", "transparent");
+      state.m_cell->m_propertyList.insert("fo:background-color", "transparent");
     else {
       STOFFColor color;
       if (m_brush.getColor(color))
-        state.m_cell.m_propertyList.insert("fo:background-color", color.str().c_str());
+        state.m_cell->m_propertyList.insert("fo:background-color", color.str().c_str());
       else {
         STOFF_DEBUG_MSG(("StarFrameAttribute::StarFAttributeBrush::addTo: can not set a cell background\n"));
-        state.m_cell.m_propertyList.insert("fo:background-color", "transparent");
+        state.m_cell->m_propertyList.insert("fo:background-color", "transparent");
       }
     }
     // Frame
     if (!m_brush.isEmpty()) {
       STOFFColor color;
       if (m_brush.getColor(color))
-        state.m_frame.m_propertyList.insert("fo:background-color", color.str().c_str());
+        state.m_frame->m_propertyList.insert("fo:background-color", color.str().c_str());
     }
   }
   // cell
   else if (m_type == ATTR_SC_BACKGROUND) {
     if (m_brush.isEmpty()) {
-      state.m_cell.m_propertyList.insert("fo:background-color", "transparent");
+      state.m_cell->m_propertyList.insert("fo:background-color", "transparent");
       return;
     }
 
     STOFFColor color;
 #if 1
     if (m_brush.getColor(color)) {
-      state.m_cell.m_propertyList.insert("fo:background-color", color.str().c_str());
+      state.m_cell->m_propertyList.insert("fo:background-color", color.str().c_str());
       return;
     }
     STOFF_DEBUG_MSG(("StarFrameAttribute::StarFAttributeBrush::addTo: can not set a cell background\n"));
-    state.m_cell.m_propertyList.insert("fo:background-color", "transparent");
+    state.m_cell->m_propertyList.insert("fo:background-color", "transparent");
 #else
     /* checkme, is it possible to use style:background-image here ?
        Can not create any working ods file with bitmap cell's background...
     */
     if (m_brush.hasUniqueColor() && m_brush.getColor(color)) {
-      state.m_cell.m_propertyList.insert("fo:background-color", color.str().c_str());
+      state.m_cell->m_propertyList.insert("fo:background-color", color.str().c_str());
       return;
     }
     STOFFEmbeddedObject object;
@@ -852,7 +852,7 @@ void StarFAttributeBrush::addTo(StarState &state, std::set<StarAttribute const *
       }
       librevenge::RVNGPropertyListVector backgroundVector;
       backgroundVector.append(backgroundList);
-      state.m_cell.m_propertyList.insert("librevenge:background-image", backgroundVector);
+      state.m_cell->m_propertyList.insert("librevenge:background-image", backgroundVector);
     }
     else {
       STOFF_DEBUG_MSG(("StarFrameAttribute::StarFAttributeBrush::addTo: can not set a cell background\n"));
@@ -861,61 +861,61 @@ void StarFAttributeBrush::addTo(StarState &state, std::set<StarAttribute const *
   }
 }
 
-void StarFAttributeFrameSize::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarFAttributeFrameSize::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_FRM_FRM_SIZE) {
     if (m_width>0) {
-      state.m_frame.m_position.setSize(STOFFVec2f(float(m_width)*0.05f, state.m_frame.m_position.m_size[1]));
-      state.m_global->m_page.m_propertiesList[0].insert("fo:page-width", double(state.m_frame.m_position.m_size[0]), librevenge::RVNG_POINT);
+      state.m_frame->m_position.setSize(STOFFVec2f(float(m_width)*0.05f, state.m_frame->m_position.m_size[1]));
+      state.m_global->m_page.m_propertiesList[0].insert("fo:page-width", double(state.m_frame->m_position.m_size[0]), librevenge::RVNG_POINT);
     }
     if (m_height>0) {
-      state.m_frame.m_position.setSize(STOFFVec2f(state.m_frame.m_position.m_size[0], float(m_height)*0.05f));
-      state.m_global->m_page.m_propertiesList[0].insert("fo:page-height", double(state.m_frame.m_position.m_size[1]), librevenge::RVNG_POINT);
+      state.m_frame->m_position.setSize(STOFFVec2f(state.m_frame->m_position.m_size[0], float(m_height)*0.05f));
+      state.m_global->m_page.m_propertiesList[0].insert("fo:page-height", double(state.m_frame->m_position.m_size[1]), librevenge::RVNG_POINT);
     }
   }
 }
 
-void StarFAttributeLineNumbering::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarFAttributeLineNumbering::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_FRM_LINENUMBER) {
     if (m_start>=0 && m_countLines) {
-      state.m_paragraph.m_propertyList.insert("text:number-lines", true);
-      state.m_paragraph.m_propertyList.insert("text:line-number", m_start==0 ? 1 : int(m_start));
+      state.m_paragraph->m_propertyList.insert("text:number-lines", true);
+      state.m_paragraph->m_propertyList.insert("text:line-number", m_start==0 ? 1 : int(m_start));
     }
   }
 }
 
-void StarFAttributeLRSpace::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarFAttributeLRSpace::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   // paragraph
   if (m_type==ATTR_FRM_LR_SPACE || m_type==ATTR_EE_PARA_OUTLLR_SPACE) {
     if (m_propMargins[0]==100) // unsure if/when we need to use textLeft/margins[0] here
-      state.m_paragraph.m_propertyList.insert("fo:margin-left", state.m_global->m_relativeUnit*double(m_textLeft), librevenge::RVNG_POINT);
+      state.m_paragraph->m_propertyList.insert("fo:margin-left", state.m_global->m_relativeUnit*double(m_textLeft), librevenge::RVNG_POINT);
     else
-      state.m_paragraph.m_propertyList.insert("fo:margin-left", double(m_propMargins[0])/100., librevenge::RVNG_PERCENT);
+      state.m_paragraph->m_propertyList.insert("fo:margin-left", double(m_propMargins[0])/100., librevenge::RVNG_PERCENT);
 
     if (m_propMargins[1]==100)
-      state.m_paragraph.m_propertyList.insert("fo:margin-right", state.m_global->m_relativeUnit*double(m_margins[1]), librevenge::RVNG_POINT);
+      state.m_paragraph->m_propertyList.insert("fo:margin-right", state.m_global->m_relativeUnit*double(m_margins[1]), librevenge::RVNG_POINT);
     else
-      state.m_paragraph.m_propertyList.insert("fo:margin-right", double(m_propMargins[1])/100., librevenge::RVNG_PERCENT);
+      state.m_paragraph->m_propertyList.insert("fo:margin-right", double(m_propMargins[1])/100., librevenge::RVNG_PERCENT);
     if (m_propMargins[2]==100)
-      state.m_paragraph.m_propertyList.insert("fo:text-indent", state.m_global->m_relativeUnit*double(m_margins[2]), librevenge::RVNG_POINT);
+      state.m_paragraph->m_propertyList.insert("fo:text-indent", state.m_global->m_relativeUnit*double(m_margins[2]), librevenge::RVNG_POINT);
     else
-      state.m_paragraph.m_propertyList.insert("fo:text-indent", double(m_propMargins[2])/100., librevenge::RVNG_PERCENT);
+      state.m_paragraph->m_propertyList.insert("fo:text-indent", double(m_propMargins[2])/100., librevenge::RVNG_PERCENT);
     // m_textLeft: ok to ignore ?
-    state.m_paragraph.m_propertyList.insert("style:auto-text-indent", m_autoFirst);
+    state.m_paragraph->m_propertyList.insert("style:auto-text-indent", m_autoFirst);
   }
   // frame
   if (m_type==ATTR_FRM_LR_SPACE) {
     if (m_propMargins[0]==100)
-      state.m_frame.m_propertyList.insert("fo:margin-left", state.m_global->m_relativeUnit*double(m_textLeft), librevenge::RVNG_POINT);
+      state.m_frame->m_propertyList.insert("fo:margin-left", state.m_global->m_relativeUnit*double(m_textLeft), librevenge::RVNG_POINT);
     else
-      state.m_frame.m_propertyList.insert("fo:margin-left", double(m_propMargins[0])/100., librevenge::RVNG_PERCENT);
+      state.m_frame->m_propertyList.insert("fo:margin-left", double(m_propMargins[0])/100., librevenge::RVNG_PERCENT);
 
     if (m_propMargins[1]==100)
-      state.m_frame.m_propertyList.insert("fo:margin-right", state.m_global->m_relativeUnit*double(m_margins[1]), librevenge::RVNG_POINT);
+      state.m_frame->m_propertyList.insert("fo:margin-right", state.m_global->m_relativeUnit*double(m_margins[1]), librevenge::RVNG_POINT);
     else
-      state.m_frame.m_propertyList.insert("fo:margin-right", double(m_propMargins[1])/100., librevenge::RVNG_PERCENT);
+      state.m_frame->m_propertyList.insert("fo:margin-right", double(m_propMargins[1])/100., librevenge::RVNG_PERCENT);
   }
   // page
   if (m_type==ATTR_FRM_LR_SPACE && state.m_global->m_pageZone<=2) {
@@ -931,13 +931,13 @@ void StarFAttributeLRSpace::addTo(StarState &state, std::set<StarAttribute const
   }
 }
 
-void StarFAttributeOrientation::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarFAttributeOrientation::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==StarAttribute::ATTR_FRM_HORI_ORIENT) {
     // NONE,RIGHT,CENTER, LEFT,INSIDE,OUTSIDE,FULL, LEFT_AND_WIDTH
     char const *wh[]= {nullptr, "right", "center", "left", "inside", "outside", nullptr, "from-left"};
     if (m_orient>=0 && m_orient<=7 && wh[m_orient])
-      state.m_frame.m_propertyList.insert("style:horizontal-pos", wh[m_orient]);
+      state.m_frame->m_propertyList.insert("style:horizontal-pos", wh[m_orient]);
 
     switch (m_orient) {
     case 0: // default
@@ -946,11 +946,11 @@ void StarFAttributeOrientation::addTo(StarState &state, std::set<StarAttribute c
     case 2:
     case 3: { // CHECKME
       char const *align[]= {"start", "center", "left"};
-      state.m_frame.m_propertyList.insert("fo:text-align", align[m_orient-1]);
+      state.m_frame->m_propertyList.insert("fo:text-align", align[m_orient-1]);
       break;
     }
     case 6:
-      state.m_frame.m_propertyList.insert("fo:text-align", "justify");
+      state.m_frame->m_propertyList.insert("fo:text-align", "justify");
       break;
     default: // TODO
       break;
@@ -960,32 +960,32 @@ void StarFAttributeOrientation::addTo(StarState &state, std::set<StarAttribute c
                            "frame-end-margin", "page", "page"
                          };
     if (m_relat>=0 && m_relat<=8 && relat[m_relat])
-      state.m_frame.m_propertyList.insert("style:horizontal-rel", relat[m_relat]);
+      state.m_frame->m_propertyList.insert("style:horizontal-rel", relat[m_relat]);
     if (m_position)
-      state.m_frame.m_position.m_propertyList.insert("svg:x", double(m_position)*0.05, librevenge::RVNG_POINT);
+      state.m_frame->m_position.m_propertyList.insert("svg:x", double(m_position)*0.05, librevenge::RVNG_POINT);
   }
   else if (m_type==StarAttribute::ATTR_FRM_VERT_ORIENT) {
     // NONE,TOP,CENTER,BOTTOM,CHAR_TOP,CHAR_CENTER,CHAR_BOTTOM,LINE_TOP,LINE_CENTER,LINE_BOTTOM
     if (m_orient>0 && m_orient<=9) {
       switch (m_orient%3) {
       case 0: // BOTTOM, CHAR_BOTTOM, LINE_BOTTOM
-        state.m_frame.m_propertyList.insert("style:vertical-pos", "bottom");
+        state.m_frame->m_propertyList.insert("style:vertical-pos", "bottom");
         break;
       case 1: // TOP, CHAR_TOP, LINE_TOP
-        state.m_frame.m_propertyList.insert("style:vertical-pos", m_position ? "from-top" : "top");
+        state.m_frame->m_propertyList.insert("style:vertical-pos", m_position ? "from-top" : "top");
         break;
       case 2: // CENTER, CHAR_CENTER, LINE_CENTER
-        state.m_frame.m_propertyList.insert("style:vertical-pos", "middle");
+        state.m_frame->m_propertyList.insert("style:vertical-pos", "middle");
         break;
       default: // nothing
         break;
       }
       switch ((m_orient-1)/3) {
       case 1:
-        state.m_frame.m_propertyList.insert("style:vertical-rel", "char");
+        state.m_frame->m_propertyList.insert("style:vertical-rel", "char");
         break;
       case 2:
-        state.m_frame.m_propertyList.insert("style:vertical-rel", "line");
+        state.m_frame->m_propertyList.insert("style:vertical-rel", "line");
         break;
       default:
         break;
@@ -996,75 +996,75 @@ void StarFAttributeOrientation::addTo(StarState &state, std::set<StarAttribute c
     case 0: // FRAME
     case 5: // FRM_LEFT
     case 6: // FRM_RIGHT
-      state.m_frame.m_propertyList.insert("style:vertical-rel", "frame");
+      state.m_frame->m_propertyList.insert("style:vertical-rel", "frame");
       break;
     case 2:
-      state.m_frame.m_propertyList.insert("style:vertical-rel", "char");
+      state.m_frame->m_propertyList.insert("style:vertical-rel", "char");
       break;
     case 3: // PG_LEFT
     case 4: // PG_RIGH
     case 7: // PG_FRAME
     case 8: // PG_PTRAREA
-      state.m_frame.m_propertyList.insert("style:vertical-rel", "page");
+      state.m_frame->m_propertyList.insert("style:vertical-rel", "page");
       break;
     default:
       break;
     }
     if (m_position)
-      state.m_frame.m_position.m_propertyList.insert("svg:y", double(m_position)*0.05, librevenge::RVNG_POINT);
+      state.m_frame->m_position.m_propertyList.insert("svg:y", double(m_position)*0.05, librevenge::RVNG_POINT);
   }
 }
 
-void StarFAttributeShadow::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarFAttributeShadow::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   // graphic
   if (m_width<=0 || m_location<=0 || m_location>4 || m_transparency<0 || m_transparency>=255)
-    state.m_graphic.m_propertyList.insert("draw:shadow", "hidden");
+    state.m_graphic->m_propertyList.insert("draw:shadow", "hidden");
   else {
-    state.m_graphic.m_propertyList.insert("draw:shadow", "visible");
-    state.m_graphic.m_propertyList.insert("draw:shadow-color", m_color.str().c_str());
-    state.m_graphic.m_propertyList.insert("draw:shadow-opacity", 1.-double(m_transparency)/255., librevenge::RVNG_PERCENT);
-    state.m_graphic.m_propertyList.insert("draw:shadow-offset-x", ((m_location%2)?-1:1)*state.convertInPoint(m_width), librevenge::RVNG_POINT);
-    state.m_graphic.m_propertyList.insert("draw:shadow-offset-y", (m_location<=2?-1:1)*state.convertInPoint(m_width), librevenge::RVNG_POINT);
+    state.m_graphic->m_propertyList.insert("draw:shadow", "visible");
+    state.m_graphic->m_propertyList.insert("draw:shadow-color", m_color.str().c_str());
+    state.m_graphic->m_propertyList.insert("draw:shadow-opacity", 1.-double(m_transparency)/255., librevenge::RVNG_PERCENT);
+    state.m_graphic->m_propertyList.insert("draw:shadow-offset-x", ((m_location%2)?-1:1)*state.convertInPoint(m_width), librevenge::RVNG_POINT);
+    state.m_graphic->m_propertyList.insert("draw:shadow-offset-y", (m_location<=2?-1:1)*state.convertInPoint(m_width), librevenge::RVNG_POINT);
   }
   // cell
   if (m_width<=0 || m_location<=0 || m_location>4 || m_transparency<0 || m_transparency>=100)
-    state.m_cell.m_propertyList.insert("style:shadow", "none");
+    state.m_cell->m_propertyList.insert("style:shadow", "none");
   else {
     std::stringstream s;
     s << m_color.str().c_str() << " "
       << ((m_location%2)?-1:1)*double(m_width)/20. << "pt "
       << (m_location<=2?-1:1)*double(m_width)/20. << "pt";
-    state.m_cell.m_propertyList.insert("style:shadow", s.str().c_str());
+    state.m_cell->m_propertyList.insert("style:shadow", s.str().c_str());
   }
 }
 
-void StarFAttributeSurround::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarFAttributeSurround::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   int surround = m_surround; // NONE, THROUGH, PARALLEL, IDEAL, LEFT, RIGHT, END
   if (m_bools[0] && surround>1) surround=3;
   if (surround>=0 && surround<=5) {
     char const *wh[]= {"none", "run-through", "parallel", "dynamic", "left", "right"};
-    state.m_frame.m_propertyList.insert("style:wrap", wh[surround]);
+    state.m_frame->m_propertyList.insert("style:wrap", wh[surround]);
   }
   // checkme what is bAnchorOnly : m_bools[1]
-  state.m_frame.m_propertyList.insert("style:wrap-countour", m_bools[2]);
-  state.m_frame.m_propertyList.insert("style:wrap-contour-mode", m_bools[3] ? "outside" : "full");
+  state.m_frame->m_propertyList.insert("style:wrap-countour", m_bools[2]);
+  state.m_frame->m_propertyList.insert("style:wrap-contour-mode", m_bools[3] ? "outside" : "full");
 }
 
-void StarFAttributeULSpace::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarFAttributeULSpace::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   // paragraph
   if (m_type==ATTR_FRM_UL_SPACE) {
     if (m_propMargins[0]==100)
-      state.m_paragraph.m_propertyList.insert("fo:margin-top", state.m_global->m_relativeUnit*double(m_margins[0]), librevenge::RVNG_POINT);
+      state.m_paragraph->m_propertyList.insert("fo:margin-top", state.m_global->m_relativeUnit*double(m_margins[0]), librevenge::RVNG_POINT);
     else
-      state.m_paragraph.m_propertyList.insert("fo:margin-top", double(m_propMargins[0])/100., librevenge::RVNG_PERCENT);
+      state.m_paragraph->m_propertyList.insert("fo:margin-top", double(m_propMargins[0])/100., librevenge::RVNG_PERCENT);
 
     if (m_propMargins[1]==100)
-      state.m_paragraph.m_propertyList.insert("fo:margin-bottom", state.m_global->m_relativeUnit*double(m_margins[1]), librevenge::RVNG_POINT);
+      state.m_paragraph->m_propertyList.insert("fo:margin-bottom", state.m_global->m_relativeUnit*double(m_margins[1]), librevenge::RVNG_POINT);
     else
-      state.m_paragraph.m_propertyList.insert("fo:margin-bottom", double(m_propMargins[1])/100., librevenge::RVNG_PERCENT);
+      state.m_paragraph->m_propertyList.insert("fo:margin-bottom", double(m_propMargins[1])/100., librevenge::RVNG_PERCENT);
   }
   // page
   if (m_type==ATTR_FRM_UL_SPACE && state.m_global->m_pageZone<=2) {
@@ -38,7 +38,10 @@
 #ifndef STAR_ITEM_HXX
 #  define STAR_ITEM_HXX
 
+#include <algorithm>
 #include <map>
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include <libstaroffice/STOFFDocument.hxx>
@@ -47,6 +50,97 @@
 
 class StarAttribute;
 
+/** \brief a small map which id to value stored in a sorted vector
+
+    \note the which ids of a set are few and generally added in
+    increasing order, so this is more compact and faster to iterate
+    than a std::map. As in a vector, adding a new which invalidates the
+    iterators and the pointers to the previous values.
+ */
+template <class T> class StarWhichMap
+{
+public:
+  //! the value type: which, value
+  typedef std::pair<int, T> value_type;
+  //! the iterator
+  typedef typename std::vector<value_type>::iterator iterator;
+  //! the const iterator
+  typedef typename std::vector<value_type>::const_iterator const_iterator;
+  //! constructor
+  StarWhichMap()
+    : m_list()
+  {
+  }
+  //! returns true if the map is empty
+  bool empty() const
+  {
+    return m_list.empty();
+  }
+  //! returns the number of which
+  size_t size() const
+  {
+    return m_list.size();
+  }
+  //! removes all the values
+  void clear()
+  {
+    m_list.clear();
+  }
+  //! returns the first iterator
+  iterator begin()
+  {
+    return m_list.begin();
+  }
+  //! returns the end iterator
+  iterator end()
+  {
+    return m_list.end();
+  }
+  //! returns the first iterator
+  const_iterator begin() const
+  {
+    return m_list.begin();
+  }
+  //! returns the end iterator
+  const_iterator end() const
+  {
+    return m_list.end();
+  }
+  //! returns the iterator corresponding to which or end()
+  iterator find(int which)
+  {
+    auto it=lowerBound(which);
+    return (it!=m_list.end() && it->first==which) ? it : m_list.end();
+  }
+  //! returns the iterator corresponding to which or end()
+  const_iterator find(int which) const
+  {
+    return const_cast<StarWhichMap *>(this)->find(which);
+  }
+  //! returns the value corresponding to which, creates it if needed
+  T &operator[](int which)
+  {
+    auto it=lowerBound(which);
+    if (it==m_list.end() || it->first!=which)
+      it=m_list.insert(it, value_type(which, T()));
+    return it->second;
+  }
+protected:
+  //! returns the first position whose which is not less than which
+  iterator lowerBound(int which)
+  {
+    // fast path: the which are often added in increasing order
+    if (m_list.empty() || m_list.back().first<which)
+      return m_list.end();
+    return std::lower_bound(m_list.begin(), m_list.end(), which,
+    [](value_type const &val, int wh) {
+      return val.first<wh;
+    });
+  }
+  //! the sorted list of which, value
+  std::vector<value_type> m_list;
+};
+
 /** \brief class to store an item: ie. an attribute whose reading is
     potentially retarded
  */
@@ -108,7 +202,7 @@ public:
   //! the family
   int m_family;
   //! the list of item
-  std::map<int, std::shared_ptr<StarItem> > m_whichToItemMap;
+  StarWhichMap<std::shared_ptr<StarItem> > m_whichToItemMap;
 };
 
 //! brief class used to stored the style
@@ -38,6 +38,7 @@
 #include <limits>
 #include <set>
 #include <sstream>
+#include <unordered_map>
 
 #include <librevenge/librevenge.h>
 
@@ -288,10 +289,22 @@ struct Version {
     : m_version(vers)
     , m_start(start)
     , m_list(list)
-    , m_invertListMap()
+    , m_invertStart(0)
+    , m_invertList()
   {
+    if (list.empty()) return;
+    auto minMax=std::minmax_element(list.begin(), list.end());
+    m_invertStart=*minMax.first;
+    m_invertList.resize(size_t(*minMax.second-m_invertStart+1), -1);
     for (size_t i=0; i<m_list.size(); ++i)
-      m_invertListMap[list[i]]=int(i);
+      m_invertList[size_t(list[i]-m_invertStart)]=int(i);
+  }
+  //! returns the offset corresponding to a which or -1
+  int getOffset(int which) const
+  {
+    if (which<m_invertStart || which>=m_invertStart+int(m_invertList.size()))
+      return -1;
+    return m_invertList[size_t(which-m_invertStart)];
   }
   //! the version number
   int m_version;
@@ -299,8 +312,66 @@ struct Version {
   int m_start;
   //! the list of value
   std::vector<int> m_list;
-  //! a map offset to which
-  std::map<int,int> m_invertListMap;
+  //! the first which stored in the invert list
+  int m_invertStart;
+  //! the list which-m_invertStart to offset (or -1)
+  std::vector<int> m_invertList;
+};
+
+/** Internal: the which tables of a type of pool
+
+    \note these tables do not depend on the file, so they are created
+    once and then shared (read-only) by all the pools of the same type */
+struct PoolDefinition {
+  //! returns the definition corresponding to a type
+  static PoolDefinition const &get(StarItemPool::Type type)
+  {
+    static PoolDefinition const definitions[]= {
+      PoolDefinition(StarItemPool::T_ChartPool), PoolDefinition(StarItemPool::T_EditEnginePool),
+      PoolDefinition(StarItemPool::T_SpreadsheetPool), PoolDefinition(StarItemPool::T_VCControlPool),
+      PoolDefinition(StarItemPool::T_WriterPool), PoolDefinition(StarItemPool::T_XOutdevPool),
+      PoolDefinition(StarItemPool::T_Unknown)
+    };
+    if (type<StarItemPool::T_ChartPool || type>StarItemPool::T_Unknown)
+      type=StarItemPool::T_Unknown;
+    return definitions[type];
+  }
+  //! the current version
+  int m_currentVersion;
+  //! the minimum version
+  int m_verStart;
+  //! the maximum version
+  int m_verEnd;
+  //! the list of version
+  std::vector<Version> m_versionList;
+  //! list whichId to attribute list
+  std::vector<int> m_idToAttributeList;
+  //! add a new version map
+  void addVersionMap(uint16_t nVers, uint16_t nStart, std::vector<int> const &list)
+  {
+    // SfxItemPool::SetVersionMap
+    if (nVers<=m_currentVersion)
+      return;
+    m_versionList.push_back(Version(int(nVers), int(nStart), list));
+    m_currentVersion=nVers;
+    Version const &vers=m_versionList.back();
+    if (vers.m_invertList.empty()) return;
+    m_verStart=std::min(m_verStart,vers.m_invertStart);
+    m_verEnd=std::max(m_verEnd,vers.m_invertStart+int(vers.m_invertList.size())-1);
+  }
+protected:
+  //! constructor
+  explicit PoolDefinition(StarItemPool::Type type)
+    : m_currentVersion(0)
+    , m_verStart(0)
+    , m_verEnd(0)
+    , m_versionList()
+    , m_idToAttributeList()
+  {
+    init(type);
+  }
+  //! initialize the tables
+  void init(StarItemPool::Type type);
 };
 
 //! internal: list of attribute corresponding to a slot id
@@ -314,7 +385,70 @@ struct Values {
   //! the default values
   std::shared_ptr<StarAttribute> m_default;
   //! the list of attribute
-  std::map<int,std::shared_ptr<StarAttribute> > m_idValueMap;
+  StarWhichMap<std::shared_ptr<StarAttribute> > m_idValueMap;
+};
+
+////////////////////////////////////////
+/** Internal: a cache used to retrieve quickly the style corresponding
+    to a name and a family
+
+    \note the entries are stored using a hash of the name and the
+    family, so a search does not need to create any string */
+struct StyleIndex {
+  //! constructor
+  StyleIndex()
+    : m_hashToEntryMap()
+  {
+  }
+  //! returns the hash of a name and a family
+  static size_t hash(librevenge::RVNGString const &name, int family)
+  {
+    return libstoff::RVNGStringHash()(name)^(size_t(unsigned(family))*size_t(0x9e3779b9U));
+  }
+  //! try to find the style corresponding to a name and a family, returns false if the search was never done
+  bool find(librevenge::RVNGString const &name, int family, StarItemStyle const *&style) const
+  {
+    auto range=m_hashToEntryMap.equal_range(hash(name, family));
+    for (auto it=range.first; it!=range.second; ++it) {
+      if (it->second.m_family!=family || it->second.m_name!=name)
+        continue;
+      style=it->second.m_style;
+      return true;
+    }
+    return false;
+  }
+  //! store the result of a search
+  void insert(librevenge::RVNGString const &name, int family, StarItemStyle const *style)
+  {
+    m_hashToEntryMap.insert(std::unordered_multimap<size_t, Entry>::value_type(hash(name, family), Entry(name, family, style)));
+  }
+  //! clear the cache
+  void clear()
+  {
+    m_hashToEntryMap.clear();
+  }
+  //! an entry: name, family, style
+  struct Entry {
+    //! constructor
+    Entry(librevenge::RVNGString const &name, int family, StarItemStyle const *style)
+      : m_name(name)
+      , m_family(family)
+      , m_style(style)
+    {
+    }
+    //! copy constructor
+    Entry(Entry const &) = default;
+    //! copy operator
+    Entry &operator=(Entry const &) = default;
+    //! the style name
+    librevenge::RVNGString m_name;
+    //! the family
+    int m_family;
+    //! the style or nullptr
+    StarItemStyle const *m_style;
+  };
+  //! the map hash to entries
+  std::unordered_multimap<size_t, Entry> m_hashToEntryMap;
 };
 
 ////////////////////////////////////////
@@ -363,14 +497,15 @@ struct State {
     , m_relativeUnit(0)
     , m_isSecondaryPool(false)
     , m_secondaryPool()
+    , m_definition(&PoolDefinition::get(StarItemPool::T_Unknown))
+    , m_localDefinition()
     , m_currentVersion(0)
     , m_verStart(0)
     , m_verEnd(0)
-    , m_versionList()
-    , m_idToAttributeList()
     , m_slotIdToValuesMap()
     , m_styleIdToStyleMap()
     , m_simplifyNameToStyleNameMap()
+    , m_styleIndex()
     , m_idToDefaultMap()
     , m_delayedItemList()
   {
@@ -382,11 +517,12 @@ struct State {
   void clean()
   {
     if (m_secondaryPool) m_secondaryPool->clean();
-    m_versionList.clear();
-    m_idToAttributeList.clear();
+    m_definition=&PoolDefinition::get(StarItemPool::T_Unknown);
+    m_localDefinition.reset();
     m_slotIdToValuesMap.clear();
     m_styleIdToStyleMap.clear();
     m_simplifyNameToStyleNameMap.clear();
+    m_styleIndex.clear();
     m_idToDefaultMap.clear();
     m_delayedItemList.clear();
   }
@@ -419,18 +555,25 @@ struct State {
     if (m_secondaryPool) return m_secondaryPool->m_state->isInRange(which);
     return false;
   }
-  //! add a new version map
+  //! add a new version map read in the file
   void addVersionMap(uint16_t nVers, uint16_t nStart, std::vector<int> const &list)
   {
-    // SfxItemPool::SetVersionMap
     if (nVers<=m_currentVersion)
       return;
-    m_versionList.push_back(Version(int(nVers), int(nStart), list));
-    m_currentVersion=nVers;
-    Version const &vers=m_versionList.back();
-    if (vers.m_invertListMap.empty()) return;
-    m_verStart=std::min(m_verStart,vers.m_invertListMap.begin()->first);
-    m_verEnd=std::max(m_verEnd,(--vers.m_invertListMap.end())->first);
+    // the shared tables are read-only, so work on a copy
+    if (!m_localDefinition) {
+      m_localDefinition.reset(new PoolDefinition(*m_definition));
+      m_definition=m_localDefinition.get();
+    }
+    m_localDefinition->addVersionMap(nVers, nStart, list);
+    m_verStart=m_definition->m_verStart;
+    m_verEnd=m_definition->m_verEnd;
+    m_currentVersion=m_definition->m_currentVersion;
+  }
+  //! returns the list whichId to attribute
+  std::vector<int> const &getIdToAttributeList() const
+  {
+    return m_definition->m_idToAttributeList;
   }
   //! try to return ???
   int getWhich(int nFileWhich) const
@@ -442,18 +585,20 @@ struct State {
       STOFF_DEBUG_MSG(("StarItemPoolInternal::State::getWhich: can not find a conversion for which=%d\n", nFileWhich));
       return 0;
     }
+    auto const &versionList=m_definition->m_versionList;
     if (m_loadingVersion>m_currentVersion) {
-      for (size_t i=m_versionList.size(); i>0;) {
-        Version const &vers=m_versionList[--i];
+      for (size_t i=versionList.size(); i>0;) {
+        Version const &vers=versionList[--i];
         if (vers.m_version<=m_currentVersion)
           break;
-        if (vers.m_invertListMap.find(nFileWhich)==vers.m_invertListMap.end())
+        int offset=vers.getOffset(nFileWhich);
+        if (offset<0)
           return 0;
-        nFileWhich=vers.m_start+vers.m_invertListMap.find(nFileWhich)->second;
+        nFileWhich=vers.m_start+offset;
       }
     }
     else if (m_loadingVersion<m_currentVersion) {
-      for (auto const &vers : m_versionList) {
+      for (auto const &vers : versionList) {
         if (vers.m_version<=m_loadingVersion)
           continue;
         if (nFileWhich<vers.m_start || nFileWhich>=vers.m_start+int(vers.m_list.size())) {
@@ -473,30 +618,33 @@ struct State {
     if (m_secondaryPool) return m_secondaryPool->m_state->getPoolStateFor(which);
     return nullptr;
   }
-  //! returns a pointer to the values data
+  /** returns a pointer to the values data
+
+      \note the pointer is only valid until the next creation */
   Values *getValues(int id, bool create=false)
   {
-    if (m_slotIdToValuesMap.find(id)!=m_slotIdToValuesMap.end())
-      return &m_slotIdToValuesMap.find(id)->second;
+    auto it=m_slotIdToValuesMap.find(id);
+    if (it!=m_slotIdToValuesMap.end())
+      return &it->second;
     if (!create)
       return nullptr;
-    m_slotIdToValuesMap[id]=Values();
-    return &m_slotIdToValuesMap.find(id)->second;
+    return &m_slotIdToValuesMap[id];
   }
   //! try to return a default attribute corresponding to which
   std::shared_ptr<StarAttribute> getDefaultAttribute(int which)
   {
-    if (m_idToDefaultMap.find(which)!=m_idToDefaultMap.end() && m_idToDefaultMap.find(which)->second)
-      return m_idToDefaultMap.find(which)->second;
+    auto it=m_idToDefaultMap.find(which);
+    if (it!=m_idToDefaultMap.end() && it->second)
+      return it->second;
     std::shared_ptr<StarAttribute> res;
     auto *state=getPoolStateFor(which);
-    if (!state || which<state->m_verStart || which>=state->m_verStart+int(state->m_idToAttributeList.size()) ||
+    if (!state || which<state->m_verStart || which>=state->m_verStart+int(state->getIdToAttributeList().size()) ||
         !state->m_document.getAttributeManager()) {
       STOFF_DEBUG_MSG(("StarItemPoolInternal::State::getDefaultAttribute: find unknown attribute\n"));
       res=StarAttributeManager::getDummyAttribute();
     }
     else
-      res=m_document.getAttributeManager()->getDefaultAttribute(state->m_idToAttributeList[size_t(which-state->m_verStart)]);
+      res=m_document.getAttributeManager()->getDefaultAttribute(state->getIdToAttributeList()[size_t(which-state->m_verStart)]);
     m_idToDefaultMap[which]=res;
     return res;
   }
@@ -518,24 +666,26 @@ struct State {
   bool m_isSecondaryPool;
   //! the secondary pool
   std::shared_ptr<StarItemPool> m_secondaryPool;
+  //! the which tables corresponding to the pool type
+  PoolDefinition const *m_definition;
+  //! a local copy of the tables if the file defines some new version maps
+  std::unique_ptr<PoolDefinition> m_localDefinition;
   //! the current version
   int m_currentVersion;
   //! the minimum version
   int m_verStart;
   //! the maximum version
   int m_verEnd;
-  //! the list of version
-  std::vector<Version> m_versionList;
-  //! list whichId to attribute list
-  std::vector<int> m_idToAttributeList;
   //! a map slot to the attribute list
-  std::map<int, Values> m_slotIdToValuesMap;
+  StarWhichMap<Values> m_slotIdToValuesMap;
   //! the set of style
   std::map<StyleId,StarItemStyle> m_styleIdToStyleMap;
   //! map simplify style name to style name
   std::map<librevenge::RVNGString, librevenge::RVNGString> m_simplifyNameToStyleNameMap;
+  //! the cache of the results of findStyleWithFamily
+  StyleIndex m_styleIndex;
   //! map of created default attribute
-  std::map<int,std::shared_ptr<StarAttribute> > m_idToDefaultMap;
+  StarWhichMap<std::shared_ptr<StarAttribute> > m_idToDefaultMap;
   //! list of item which need to be read
   std::vector<std::shared_ptr<StarItem> > m_delayedItemList;
 private:
@@ -550,11 +700,15 @@ void State::init(StarItemPool::Type type)
     STOFF_DEBUG_MSG(("StarItemPoolInternal::State::init: arghhhh, change pool type\n"));
   }
   m_type=type;
-  // reset internal data
-  m_verStart=m_verEnd=m_currentVersion=0;
-  m_versionList.clear();
-  m_idToAttributeList.clear();
+  m_definition=&PoolDefinition::get(type);
+  m_localDefinition.reset();
+  m_verStart=m_definition->m_verStart;
+  m_verEnd=m_definition->m_verEnd;
+  m_currentVersion=m_definition->m_currentVersion;
+}
 
+void PoolDefinition::init(StarItemPool::Type type)
+{
   // to do VCControls
   switch (type) {
   case StarItemPool::T_ChartPool: {
@@ -969,7 +1123,7 @@ std::shared_ptr<StarAttribute> StarItemPool::readAttribute(StarZone &zone, int w
     which=m_state->getWhich(which);
 
   auto *state=m_state->getPoolStateFor(which);
-  if (!state || which<state->m_verStart || which>=state->m_verStart+int(state->m_idToAttributeList.size()) ||
+  if (!state || which<state->m_verStart || which>=state->m_verStart+int(state->getIdToAttributeList().size()) ||
       !state->m_document.getAttributeManager()) {
     STOFFInputStreamPtr input=zone.input();
     long pos=input->tell();
@@ -984,7 +1138,7 @@ std::shared_ptr<StarAttribute> StarItemPool::readAttribute(StarZone &zone, int w
   }
   zone.openDummyRecord();
   auto attribute=state->m_document.getAttributeManager()->readAttribute
-                 (zone, state->m_idToAttributeList[size_t(which-state->m_verStart)], vers, endPos, state->m_document);
+                 (zone, state->getIdToAttributeList()[size_t(which-state->m_verStart)], vers, endPos, state->m_document);
   zone.closeDummyRecord();
   return attribute;
 }
@@ -1149,12 +1303,13 @@ bool StarItemPool::loadSurrogate(StarItem &item)
       item.m_attribute=values->m_default;
     return true;
   }
-  if (!values || values->m_idValueMap.find(item.m_surrogateId)==values->m_idValueMap.end()) {
+  auto vIt=values ? values->m_idValueMap.find(item.m_surrogateId) : StarWhichMap<std::shared_ptr<StarAttribute> >::iterator();
+  if (!values || vIt==values->m_idValueMap.end()) {
     STOFF_DEBUG_MSG(("StarItemPool::loadSurrogate: can not find the attribute array for %d[%d]\n", aWhich, item.m_surrogateId));
     item.m_attribute=m_state->getDefaultAttribute(aWhich);
     return true;
   }
-  item.m_attribute=values->m_idValueMap.find(item.m_surrogateId)->second;
+  item.m_attribute=vIt->second;
 
   return true;
 }
@@ -1194,7 +1349,8 @@ std::shared_ptr<StarItem> StarItemPool::loadSurrogate(StarZone &zone, uint16_t &
     return res;
   }
   f << "surrog=" << nSurrog << ",";
-  if (!values || values->m_idValueMap.find(int(nSurrog))==values->m_idValueMap.end()) {
+  auto vIt=values ? values->m_idValueMap.find(int(nSurrog)) : StarWhichMap<std::shared_ptr<StarAttribute> >::iterator();
+  if (!values || vIt==values->m_idValueMap.end()) {
     if (isInside()) {
       // ok, we must wait that the pool is read
       return createItem(int(nWhich), int(nSurrog), localId);
@@ -1204,7 +1360,7 @@ std::shared_ptr<StarItem> StarItemPool::loadSurrogate(StarZone &zone, uint16_t &
     res->m_attribute=m_state->getDefaultAttribute(aWhich);
     return res;
   }
-  res->m_attribute=values->m_idValueMap.find(int(nSurrog))->second;
+  res->m_attribute=vIt->second;
   return res;
 }
 
@@ -1938,8 +2094,10 @@ bool StarItemPool::readStyles(StarZone &zone, StarObject &doc)
     if (m_state->m_styleIdToStyleMap.find(styleId)!=m_state->m_styleIdToStyleMap.end()) {
       STOFF_DEBUG_MSG(("StarItemPool::readStyles: style %s-%d\n", style.m_names[0].cstr(), style.m_family));
     }
-    else
+    else {
       m_state->m_styleIdToStyleMap[styleId]=style;
+      m_state->m_styleIndex.clear();
+    }
     f << style;
     ascii.addDelimiter(input->tell(),'|');
     uint16_t nVer;
@@ -2070,7 +2228,7 @@ void StarItemPool::updateStyles()
 {
   std::set<StarItemPoolInternal::StyleId> done, toDo;
   std::multimap<StarItemPoolInternal::StyleId, StarItemPoolInternal::StyleId> childMap;
-  std::map<int, std::shared_ptr<StarItem> >::const_iterator iIt;
+  StarWhichMap<std::shared_ptr<StarItem> >::const_iterator iIt;
   for (auto it : m_state->m_styleIdToStyleMap) {
     if (it.second.m_names[1].empty())
       toDo.insert(it.first);
@@ -2124,8 +2282,9 @@ void StarItemPool::updateStyles()
      files), so create a map to try to retrieve the real style name
      from a bad encoded style name...
    */
+  m_state->m_styleIndex.clear();
   std::set<librevenge::RVNGString> dupplicatedSimpName;
-  for (auto it : m_state->m_styleIdToStyleMap) {
+  for (auto const &it : m_state->m_styleIdToStyleMap) {
     if (it.second.m_names[0].empty()) continue;
     auto simpName=libstoff::simplifyString(it.second.m_names[0]);
     if (it.second.m_names[0]==simpName || dupplicatedSimpName.find(simpName)!=dupplicatedSimpName.end()) continue;
@@ -2142,6 +2301,16 @@ StarItemStyle const *StarItemPool::findStyleWithFamily(librevenge::RVNGString co
 {
   if (style.empty())
     return nullptr;
+  StarItemStyle const *res=nullptr;
+  if (m_state->m_styleIndex.find(style, family, res))
+    return res;
+  res=findStyleWithFamilyInList(style, family);
+  m_state->m_styleIndex.insert(style, family, res);
+  return res;
+}
+
+StarItemStyle const *StarItemPool::findStyleWithFamilyInList(librevenge::RVNGString const &style, int family) const
+{
   for (int step=0; step<2; ++step) {
     librevenge::RVNGString name(style);
     if (step==1) {
@@ -2163,6 +2332,23 @@ StarItemStyle const *StarItemPool::findStyleWithFamily(librevenge::RVNGString co
   return nullptr;
 }
 
+void StarItemPool::defineGraphicStyle(STOFFListenerPtr &listener, librevenge::RVNGString const &styleName, StarObject &object) const
+{
+  // first check if the style is already defined to avoid creating the set of visited styles
+  if (!listener || styleName.empty() || listener->isGraphicStyleDefined(styleName))
+    return;
+  std::set<librevenge::RVNGString> done;
+  defineGraphicStyle(listener, styleName, object, done);
+}
+
+void StarItemPool::defineParagraphStyle(STOFFListenerPtr &listener, librevenge::RVNGString const &styleName, StarObject &object) const
+{
+  if (!listener || styleName.empty() || listener->isParagraphStyleDefined(styleName))
+    return;
+  std::set<librevenge::RVNGString> done;
+  defineParagraphStyle(listener, styleName, object, done);
+}
+
 void StarItemPool::defineGraphicStyle(STOFFListenerPtr listener, librevenge::RVNGString const &styleName, StarObject &object, std::set<librevenge::RVNGString> &done) const
 {
   if (styleName.empty() || done.find(styleName)!=done.end())
@@ -2180,22 +2366,22 @@ void StarItemPool::defineGraphicStyle(STOFFListenerPtr listener, librevenge::RVN
     return;
   }
   StarState state(this, object);
-  state.m_frame.addTo(state.m_graphic.m_propertyList);
-  state.m_graphic.m_propertyList.insert("style:display-name", styleName);
+  state.m_frame.get().addTo(state.m_graphic->m_propertyList);
+  state.m_graphic->m_propertyList.insert("style:display-name", styleName);
   if (!style->m_names[1].empty()) {
     if (done.find(style->m_names[1])!=done.end()) {
       STOFF_DEBUG_MSG(("StarItemPool::defineGraphicStyle: oops find a look with %s", style->m_names[1].cstr()));
     }
     else {
       defineGraphicStyle(listener, style->m_names[1], object, done);
-      state.m_graphic.m_propertyList.insert("librevenge:parent-display-name", style->m_names[1]);
+      state.m_graphic->m_propertyList.insert("librevenge:parent-display-name", style->m_names[1]);
     }
   }
-  for (auto it : style->m_itemSet.m_whichToItemMap) {
+  for (auto const &it : style->m_itemSet.m_whichToItemMap) {
     if (it.second && it.second->m_attribute)
       it.second->m_attribute->addTo(state);
   }
-  listener->defineStyle(state.m_graphic);
+  listener->defineStyle(state.m_graphic.get());
 }
 
 void StarItemPool::defineParagraphStyle(STOFFListenerPtr listener, librevenge::RVNGString const &styleName, StarObject &object, std::set<librevenge::RVNGString> &done) const
@@ -2216,36 +2402,24 @@ void StarItemPool::defineParagraphStyle(STOFFListenerPtr listener, librevenge::R
   }
   StarState state(this, object);
   if (style->m_outlineLevel>=0 && style->m_outlineLevel<20) {
-    state.m_paragraph.m_outline=true;
-    state.m_paragraph.m_listLevelIndex=style->m_outlineLevel+1;
+    state.m_paragraph->m_outline=true;
+    state.m_paragraph->m_listLevelIndex=style->m_outlineLevel+1;
   }
-  state.m_paragraph.m_propertyList.insert("style:display-name", styleName);
+  state.m_paragraph->m_propertyList.insert("style:display-name", styleName);
   if (!style->m_names[1].empty()) {
     if (done.find(style->m_names[1])!=done.end()) {
       STOFF_DEBUG_MSG(("StarItemPool::defineParagraphStyle: oops find a look with %s", style->m_names[1].cstr()));
     }
     else {
       defineParagraphStyle(listener, style->m_names[1], object, done);
-      state.m_paragraph.m_propertyList.insert("librevenge:parent-display-name", style->m_names[1]);
+      state.m_paragraph->m_propertyList.insert("librevenge:parent-display-name", style->m_names[1]);
     }
   }
-  for (auto it : style->m_itemSet.m_whichToItemMap) {
+  for (auto const &it : style->m_itemSet.m_whichToItemMap) {
     if (it.second && it.second->m_attribute)
       it.second->m_attribute->addTo(state);
   }
-  listener->defineStyle(state.m_paragraph);
-}
-
-void StarItemPool::updateUsingStyles(StarItemSet &itemSet) const
-{
-  auto const *style=findStyleWithFamily(itemSet.m_style, itemSet.m_family);
-  if (!style) return;
-  auto const &parentItemSet=style->m_itemSet;
-  for (auto it : parentItemSet.m_whichToItemMap) {
-    if (!it.second || itemSet.m_whichToItemMap.find(it.first)!=itemSet.m_whichToItemMap.end())
-      continue;
-    itemSet.m_whichToItemMap[it.first]=it.second;
-  }
+  listener->defineStyle(state.m_paragraph.get());
 }
 
 // vim: set filetype=cpp tabstop=2 shiftwidth=2 cindent autoindent smartindent noexpandtab:
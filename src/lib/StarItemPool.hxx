@@ -101,20 +101,10 @@ public:
 
    \note must be called after all styles have been updated */
   void updateStyles();
-  /** update a itemset by adding attribute corresponding to its styles*/
-  void updateUsingStyles(StarItemSet &itemSet) const;
   /** define a graphic style */
-  void defineGraphicStyle(STOFFListenerPtr &listener, librevenge::RVNGString const &styleName, StarObject &object) const
-  {
-    std::set<librevenge::RVNGString> done;
-    defineGraphicStyle(listener, styleName, object, done);
-  }
+  void defineGraphicStyle(STOFFListenerPtr &listener, librevenge::RVNGString const &styleName, StarObject &object) const;
   /** define a paragraph style */
-  void defineParagraphStyle(STOFFListenerPtr &listener, librevenge::RVNGString const &styleName, StarObject &object) const
-  {
-    std::set<librevenge::RVNGString> done;
-    defineParagraphStyle(listener, styleName, object, done);
-  }
+  void defineParagraphStyle(STOFFListenerPtr &listener, librevenge::RVNGString const &styleName, StarObject &object) const;
   /** try to find a style with a name and a family style */
   StarItemStyle const *findStyleWithFamily(librevenge::RVNGString const &style, int family) const;
   //! try to read an attribute
@@ -134,6 +124,8 @@ protected:
   void defineGraphicStyle(STOFFListenerPtr listener, librevenge::RVNGString const &styleName, StarObject &object, std::set<librevenge::RVNGString> &done) const;
   /** define a paragraph style */
   void defineParagraphStyle(STOFFListenerPtr listener, librevenge::RVNGString const &styleName, StarObject &object, std::set<librevenge::RVNGString> &done) const;
+  /** try to find a style with a name and a family style in the list of styles (without using the cache) */
+  StarItemStyle const *findStyleWithFamilyInList(librevenge::RVNGString const &style, int family) const;
   //! try to read a "ItemPool" zone (version 1)
   bool readV1(StarZone &zone, StarItemPool *master);
   //! try to read a "ItemPool" zone (version 2)
@@ -79,6 +79,7 @@ private:
 ////////////////////////////////////////////////////////////
 StarObject::StarObject(char const *passwd, std::shared_ptr<STOFFOLEParser> &oleParser, std::shared_ptr<STOFFOLEParser::OleDirectory> &directory)
   : m_password(passwd)
+  , m_textOnly(false)
   , m_oleParser(oleParser)
   , m_directory(directory)
   , m_state(new StarObjectInternal::State())
@@ -88,6 +89,7 @@ StarObject::StarObject(char const *passwd, std::shared_ptr<STOFFOLEParser> &oleP
 
 StarObject::StarObject(StarObject const &orig, bool duplicateState)
   : m_password(orig.m_password)
+  , m_textOnly(orig.m_textOnly)
   , m_oleParser(orig.m_oleParser)
   , m_directory(orig.m_directory)
   , m_state()
@@ -95,8 +97,12 @@ StarObject::StarObject(StarObject const &orig, bool duplicateState)
 {
   if (duplicateState)
     m_state.reset(new StarObjectInternal::State(*orig.m_state));
-  else
+  else {
     m_state.reset(new StarObjectInternal::State);
+    // the attribute manager only stores the shared simple attributes,
+    // so the embedded objects can use the document's one
+    m_state->m_attributeManager=orig.m_state->m_attributeManager;
+  }
 }
 
 StarObject::~StarObject()
@@ -189,6 +195,11 @@ bool StarObject::parse()
     }
 
     ole->setReadInverted(true);
+    if (m_textOnly && (base=="persist elements" || base=="SfxPreview" || base=="SfxWindows" || base=="Star Framework Config File")) {
+      // the embedded objects, the preview, ... are not needed to retrieve the text
+      content.setParsed(true);
+      continue;
+    }
     if (base=="VCPool") {
       content.setParsed(true);
       StarZone zone(ole, name, "VCPool", m_password);
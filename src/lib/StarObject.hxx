@@ -77,6 +77,17 @@ public:
   bool parse();
   //! returns the document kind
   STOFFDocument::Kind getDocumentKind() const;
+  //! returns true if we only need to retrieve the document's text
+  bool isTextOnly() const
+  {
+    return m_textOnly;
+  }
+  /** sets the text only flag: if set, the zones which can not contain
+      the document's text (layout, page styles, preview, ...) are skipped */
+  void setTextOnly(bool textOnly)
+  {
+    m_textOnly=textOnly;
+  }
   //! returns the document password (the password given by the user)
   char const *getPassword() const
   {
@@ -110,6 +121,8 @@ public:
   //! returns the current all/inside pool
   std::shared_ptr<StarItemPool> getCurrentPool(bool onlyInside=true);
 
+  //! try to read the document information : "SfxDocumentInformation"
+  bool readSfxDocumentInformation(STOFFInputStreamPtr input, std::string const &name);
   //! try to read persist data
   bool readPersistData(StarZone &zone, long endPos);
   //! try to read a spreadshet style zone: SfxStyleSheets
@@ -120,8 +133,6 @@ public:
 protected:
   //!  the "persist elements" small ole: the list of object
   bool readPersistElements(STOFFInputStreamPtr input, std::string const &name);
-  //! try to read the document information : "SfxDocumentInformation"
-  bool readSfxDocumentInformation(STOFFInputStreamPtr input, std::string const &name);
   //! try to read the preview : "SfxPreview"
   bool readSfxPreview(STOFFInputStreamPtr input, std::string const &name);
   //! try to read the windows information : "SfxWindows"
@@ -139,6 +150,8 @@ protected:
   StarObject(StarObject const &orig, bool duplicateState);
   //! the document password
   char const *m_password;
+  //! a flag to know if we only need to retrieve the document's text
+  bool m_textOnly;
   //! the ole parser
   std::shared_ptr<STOFFOLEParser> m_oleParser;
   //! the directory
@@ -64,12 +64,15 @@ struct State {
   State()
     : m_model()
     , m_numPages()
+    , m_pageRange(0,0)
   {
   }
   //! the model
   std::shared_ptr<StarObjectModel> m_model;
   //! the list of pages number
   int m_numPages;
+  //! the range of pages to send: first, last (from 1), 0 means no limit
+  STOFFVec2i m_pageRange;
 };
 
 }
@@ -105,6 +108,11 @@ bool StarObjectDraw::updatePageSpans(std::vector<STOFFPageSpan> &pageSpan, int &
   return numPages>0;
 }
 
+void StarObjectDraw::setPageRange(STOFFVec2i const &range)
+{
+  m_drawState->m_pageRange=range;
+}
+
 bool StarObjectDraw::sendMasterPages(STOFFGraphicListenerPtr listener)
 {
   if (!m_drawState->m_model)
@@ -207,6 +215,7 @@ try
   }
   input->seek(0, librevenge::RVNG_SEEK_SET);
   std::shared_ptr<StarObjectModel> model(new StarObjectModel(*this, true));
+  model->setPageRange(m_drawState->m_pageRange);
   if (!model->read(zone)) {
     STOFF_DEBUG_MSG(("StarObjectDraw::readDrawDocument: can not read the main zone\n"));
     ascFile.addPos(0);
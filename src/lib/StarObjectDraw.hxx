@@ -67,6 +67,8 @@ public:
   ~StarObjectDraw() override;
   //! try to parse the current object
   bool parse();
+  //! sets the range of pages to send: first, last (from 1), 0 means no limit
+  void setPageRange(STOFFVec2i const &range);
 
   /** try to update the page span (to create draw document)*/
   bool updatePageSpans(std::vector<STOFFPageSpan> &pageSpan, int &numPages) const;
@@ -262,8 +262,20 @@ struct State {
     , m_pageToSendList()
     , m_masterPageToSendSet()
     , m_idToObjectMap()
+    , m_pageRange(0,0)
+    , m_numReadPages(0)
   {
   }
+  //! returns true if only a range of pages must be sent
+  bool hasPageRange() const
+  {
+    return m_pageRange[0]>0 || m_pageRange[1]>0;
+  }
+  //! returns true if the n^th page to send (from 1) is in the page range
+  bool isInPageRange(int n) const
+  {
+    return n>=m_pageRange[0] && (m_pageRange[1]<=0 || n<=m_pageRange[1]);
+  }
   //! small operator<< to print the content of the state
   friend std::ostream &operator<<(std::ostream &o, State const &state)
   {
@@ -330,7 +342,10 @@ struct State {
   std::set<int> m_masterPageToSendSet;
   //! a map objectId to object
   std::map<int, std::shared_ptr<StarObjectSmallGraphic> > m_idToObjectMap;
-
+  //! the range of pages to send: first, last (from 1), 0 means no limit
+  STOFFVec2i m_pageRange;
+  //! the number of pages to send found when reading the pages
+  int m_numReadPages;
 };
 
 }
@@ -374,12 +389,14 @@ bool StarObjectModel::updatePageSpans(std::vector<STOFFPageSpan> &pageSpan, int
     return true;
   }
   auto numMasterPage=int(m_modelState->m_masterPageList.size());
+  int numPages=0;
   for (size_t i=0; i<m_modelState->m_pageList.size(); ++i) {
     if (!m_modelState->m_pageList[i])
       continue;
     auto const &page=*m_modelState->m_pageList[i];
     int id=page.getMasterPageId();
     if (id<=0 || (id&1)!=1) continue;
+    if (!m_modelState->isInPageRange(++numPages)) continue;
     m_modelState->m_pageToSendList.push_back(int(i));
     STOFFPageSpan ps;
     page.updatePageSpan(ps, relUnit);
@@ -409,6 +426,11 @@ void StarObjectModel::updateObjectIds(std::set<long> &unusedId)
   }
 }
 
+void StarObjectModel::setPageRange(STOFFVec2i const &range)
+{
+  m_modelState->m_pageRange=range;
+}
+
 bool StarObjectModel::sendObject(int id, STOFFListenerPtr listener, StarState const &state)
 {
   auto it=m_modelState->m_idToObjectMap.find(id);
@@ -416,7 +438,7 @@ bool StarObjectModel::sendObject(int id, STOFFListenerPtr listener, StarState co
     STOFF_DEBUG_MSG(("StarObjectModel::sendObject: can not find object %d\n", id));
     return false;
   }
-  return it->second->send(listener, state.m_frame, *this);
+  return it->second->send(listener, state.m_frame.get(), *this);
 }
 
 bool StarObjectModel::sendPages(STOFFListenerPtr listener)
@@ -1051,8 +1073,19 @@ std::shared_ptr<StarObjectModelInternal::Page> StarObjectModel::readSdrPage(Star
     ascFile.addPos(pos);
     ascFile.addNote(f.str().c_str());
   }
+  bool skipObjects=false;
+  if (!page->m_masterPage && m_modelState->hasPageRange()) {
+    // only the pages with an odd master page are sent, see updatePageSpans
+    int id=page->getMasterPageId();
+    skipObjects=id<=0 || (id&1)!=1 || !m_modelState->isInPageRange(++m_modelState->m_numReadPages);
+  }
+  if (skipObjects) {
+    ascFile.addPos(input->tell());
+    ascFile.addNote("SdrPageDef[objects]:skipped");
+    input->seek(lastPos, librevenge::RVNG_SEEK_SET);
+  }
   // SdrObjList::Load
-  while (ok) {
+  while (ok && !skipObjects) {
     pos=input->tell();
     if (pos+4>lastPos)
       break;
@@ -1078,7 +1111,7 @@ std::shared_ptr<StarObjectModelInternal::Page> StarObjectModel::readSdrPage(Star
     input->seek(pos, librevenge::RVNG_SEEK_SET);
     break;
   }
-  if (ok && version>=16) {
+  if (ok && !skipObjects && version>=16) {
     pos=input->tell();
     f.str("");
     f << "SdrPageDef[background-" << zone.getRecordLevel() << "]:";
@@ -68,6 +68,10 @@ public:
   StarObjectModel(StarObject const &orig, bool duplicateState);
   //! destructor
   ~StarObjectModel() override;
+  /** sets the range of pages to send: first, last (from 1), 0 means no limit
+
+      \note must be called before read: the objects of the other pages are not read */
+  void setPageRange(STOFFVec2i const &range);
   //! try to read a SdrModel zone: "DrMd"
   bool read(StarZone &zone);
   /** try to update the object id of page 0
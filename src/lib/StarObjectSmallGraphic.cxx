@@ -272,6 +272,11 @@ public:
     }
     return false;
   }
+  //! try to send only the text of the graphic to the listener, ie. in text only mode
+  virtual bool sendText(STOFFListenerPtr &/*listener*/, STOFFFrameStyle const &/*pos*/, StarObject &/*object*/, bool /*inMasterPage*/)
+  {
+    return false;
+  }
   //! the type
   int m_identifier;
 };
@@ -329,14 +334,14 @@ public:
   //! try to update the graphic style
   void updateStyle(StarState &state, STOFFListenerPtr /*listener*/) const
   {
-    state.m_frame.addStyleTo(state.m_graphic.m_propertyList);
+    state.m_frame->addStyleTo(state.m_graphic->m_propertyList);
     if (m_flags[0] && m_flags[1])
-      state.m_graphic.m_propertyList.insert("style:protect", "position size");
+      state.m_graphic->m_propertyList.insert("style:protect", "position size");
     else if (m_flags[0])
-      state.m_graphic.m_propertyList.insert("style:protect", "position");
+      state.m_graphic->m_propertyList.insert("style:protect", "position");
     else if (m_flags[1])
-      state.m_graphic.m_propertyList.insert("style:protect", "size");
-    state.m_graphic.m_propertyList.insert("style:print-content", !m_flags[2]);
+      state.m_graphic->m_propertyList.insert("style:protect", "size");
+    state.m_graphic->m_propertyList.insert("style:print-content", !m_flags[2]);
     // todo noVisible as master ie hide in master
   }
   //! basic print function
@@ -412,10 +417,10 @@ public:
       auto const *mStyle=state.m_global->m_pool->findStyleWithFamily(m_sheetStyle, StarItemStyle::F_Paragraph);
       if (mStyle && !mStyle->m_names[0].empty()) {
         if (listener) state.m_global->m_pool->defineGraphicStyle(listener, mStyle->m_names[0], state.m_global->m_object);
-        state.m_graphic.m_propertyList.insert("librevenge:parent-display-name", mStyle->m_names[0]);
+        state.m_graphic->m_propertyList.insert("librevenge:parent-display-name", mStyle->m_names[0]);
       }
       else if (mStyle) {
-        for (auto it : mStyle->m_itemSet.m_whichToItemMap) {
+        for (auto const &it : mStyle->m_itemSet.m_whichToItemMap) {
           if (it.second && it.second->m_attribute)
             it.second->m_attribute->addTo(state);
         }
@@ -493,6 +498,23 @@ public:
     listener->closeGroup();
     return true;
   }
+  //! try to send the text of the child to the listener
+  bool sendText(STOFFListenerPtr &listener, STOFFFrameStyle const &pos, StarObject &object, bool inMasterPage) final
+  {
+    if (!listener) {
+      STOFF_DEBUG_MSG(("StarObjectSmallGraphicInternal::SdrGraphicGroup::sendText: unexpected listener\n"));
+      return false;
+    }
+    STOFFFrameStyle finalPos(pos);
+    StarState state(getState(object, listener, finalPos));
+    finalPos.m_position.m_offset=state.m_global->m_offset;
+    finalPos.m_position.m_offset=true;
+    for (auto &child : m_child) {
+      if (child)
+        child->send(listener, finalPos, object, inMasterPage);
+    }
+    return true;
+  }
   //! print object data
   friend std::ostream &operator<<(std::ostream &o, SdrGraphicGroup const &graph)
   {
@@ -581,21 +603,31 @@ public:
     position.setSize(state.convertVectorInPoint(box.size()));
     if (position.m_anchorTo==STOFFPosition::Unknown)
       position.setAnchor(STOFFPosition::Page);
-    updateStyle(state, listener);
-    // if (!state.m_graphic.m_hasBackground) state.m_graphic.m_propertyList.insert("draw:fill", "none"); checkme
-    state.m_graphic.m_propertyList.insert("draw:fill", "none");
-    state.m_graphic.m_propertyList.insert("draw:shadow", "hidden"); // the text is not shadowed
-    if (m_textDrehWink) {
+    // in text only mode, the graphic style is not retrieved
+    bool textOnly=object.isTextOnly();
+    if (!textOnly)
+      updateStyle(state, listener);
+    // if (!state.m_graphic->m_hasBackground) state.m_graphic->m_propertyList.insert("draw:fill", "none"); checkme
+    state.m_graphic->m_propertyList.insert("draw:fill", "none");
+    state.m_graphic->m_propertyList.insert("draw:shadow", "hidden"); // the text is not shadowed
+    if (m_textDrehWink && !textOnly) {
       // checkme: this can not work for a text listener. We must create a rectangle with text instead
       STOFFVec2f const &orig=position.m_origin;
-      state.m_graphic.m_propertyList.insert("librevenge:rotate-cx", orig[0], librevenge::RVNG_POINT);
-      state.m_graphic.m_propertyList.insert("librevenge:rotate-cy", orig[1], librevenge::RVNG_POINT);
-      state.m_graphic.m_propertyList.insert("librevenge:rotate", -(m_textDrehWink/100.), librevenge::RVNG_GENERIC);
+      state.m_graphic->m_propertyList.insert("librevenge:rotate-cx", orig[0], librevenge::RVNG_POINT);
+      state.m_graphic->m_propertyList.insert("librevenge:rotate-cy", orig[1], librevenge::RVNG_POINT);
+      state.m_graphic->m_propertyList.insert("librevenge:rotate", -(m_textDrehWink/100.), librevenge::RVNG_GENERIC);
     }
     std::shared_ptr<SubDocument> doc(new SubDocument(m_outlinerParaObject));
-    listener->insertTextBox(frame, doc, state.m_graphic);
+    listener->insertTextBox(frame, doc, state.m_graphic.get());
     return true;
   }
+  //! try to send only the text zone to the listener
+  bool sendText(STOFFListenerPtr &listener, STOFFFrameStyle const &pos, StarObject &object, bool inMasterPage) override
+  {
+    if (!m_outlinerParaObject || (inMasterPage && (m_identifier==20 || m_identifier==21)))
+      return false;
+    return sendTextZone(listener, pos, object);
+  }
   //! print object data
   friend std::ostream &operator<<(std::ostream &o, SdrGraphicText const &graph)
   {
@@ -655,7 +687,7 @@ public:
       shape.m_bdbox=STOFFBox2f(state.convertPointInPoint(m_textRectangle[0]), state.convertPointInPoint(m_textRectangle[1]));
       updateTransformProperties(shape.m_propertyList, state.m_global->m_relativeUnit);
       updateStyle(state, listener);
-      listener->insertShape(pos, shape, state.m_graphic);
+      listener->insertShape(pos, shape, state.m_graphic.get());
       if (m_outlinerParaObject)
         sendTextZone(listener, pos, object);
     }
@@ -739,7 +771,7 @@ public:
     shape.m_propertyList.insert("svg:d", path);
     updateTransformProperties(shape.m_propertyList, state.m_global->m_relativeUnit);
     updateStyle(state, listener);
-    listener->insertShape(pos, shape, state.m_graphic);
+    listener->insertShape(pos, shape, state.m_graphic.get());
     return true;
   }
   //! a polygon
@@ -797,7 +829,7 @@ public:
     }
     updateTransformProperties(shape.m_propertyList, state.m_global->m_relativeUnit);
     updateStyle(state, listener);
-    listener->insertShape(pos, shape, state.m_graphic);
+    listener->insertShape(pos, shape, state.m_graphic.get());
     if (m_outlinerParaObject)
       sendTextZone(listener, pos, object);
     return true;
@@ -922,7 +954,7 @@ public:
     shape.m_propertyList.insert("svg:d", path);
     updateTransformProperties(shape.m_propertyList, state.m_global->m_relativeUnit);
     updateStyle(state, listener);
-    listener->insertShape(pos, shape, state.m_graphic);
+    listener->insertShape(pos, shape, state.m_graphic.get());
     return true;
   }
   //! the edge polygon
@@ -988,10 +1020,10 @@ public:
       // CHECKME: we need probably correct the filename, transform ":" in "/", ...
       STOFFEmbeddedObject link;
       link.m_filenameLink=m_graphNames[1];
-      listener->insertPicture(frame, link, state.m_graphic);
+      listener->insertPicture(frame, link, state.m_graphic.get());
     }
     else
-      listener->insertPicture(frame, m_graphic->m_object, state.m_graphic);
+      listener->insertPicture(frame, m_graphic->m_object, state.m_graphic.get());
 
     return true;
   }
@@ -1083,7 +1115,7 @@ public:
     }
     shape.m_propertyList.insert("svg:points", vect);
     updateTransformProperties(shape.m_propertyList, state.m_global->m_relativeUnit);
-    listener->insertShape(pos, shape, state.m_graphic);
+    listener->insertShape(pos, shape, state.m_graphic.get());
     return true;
   }
   //! try to update the style
@@ -1148,7 +1180,7 @@ public:
       return false;
     }
     StarState state(getState(object, listener, pos));
-    STOFFPosition &position=state.m_frame.m_position;
+    STOFFPosition &position=state.m_frame->m_position;
     position=pos.m_position;
     position.setOrigin(state.convertPointInPoint(m_bdbox[0]));
     position.setSize(state.convertVectorInPoint(m_bdbox.size()));
@@ -1160,14 +1192,14 @@ public:
       if (!dir || !StarFileManager::readOLEDirectory(m_oleParser, dir, localPicture, localObj) || localPicture.isEmpty()) {
         if (localObj) {
           auto chart=std::dynamic_pointer_cast<StarObjectChart>(localObj);
-          if (chart && chart->send(listener, state.m_frame, state.m_graphic)) {
+          if (chart && chart->send(listener, state.m_frame.get(), state.m_graphic.get())) {
             if (m_graphic && !m_graphic->m_object.isEmpty()) {
               STOFF_DEBUG_MSG(("StarObjectSmallGraphicInternal::SdrGraphicOLE::send: find extra graphic for chart %s\n", m_oleNames[0].cstr()));
             }
             return true;
           }
           auto math=std::dynamic_pointer_cast<StarObjectMath>(localObj);
-          if (math && math->send(listener, state.m_frame, state.m_graphic)) {
+          if (math && math->send(listener, state.m_frame.get(), state.m_graphic.get())) {
             if (m_graphic && !m_graphic->m_object.isEmpty()) {
               STOFF_DEBUG_MSG(("StarObjectSmallGraphicInternal::SdrGraphicOLE::send: find extra graphic for math %s\n", m_oleNames[0].cstr()));
             }
@@ -1200,7 +1232,7 @@ public:
       STOFF_DEBUG_MSG(("StarObjectSmallGraphicInternal::SdrGraphicOLE::send: sorry, can not find some graphic representation\n"));
       return SdrGraphicRect::send(listener, pos, object, inMasterPage);
     }
-    listener->insertPicture(state.m_frame, localPicture, state.m_graphic);
+    listener->insertPicture(state.m_frame.get(), localPicture, state.m_graphic.get());
 
     return true;
   }
@@ -1339,7 +1371,7 @@ bool SdrGraphicPath::send(STOFFListenerPtr &listener, STOFFFrameStyle const &pos
       }
       shape.m_propertyList.insert("svg:points", vect);
       updateTransformProperties(shape.m_propertyList, state.m_global->m_relativeUnit);
-      listener->insertShape(pos, shape, state.m_graphic);
+      listener->insertShape(pos, shape, state.m_graphic.get());
       if (m_outlinerParaObject)
         sendTextZone(listener, pos, object);
       return true;
@@ -1394,7 +1426,7 @@ bool SdrGraphicPath::send(STOFFListenerPtr &listener, STOFFFrameStyle const &pos
     shape.m_propertyList.insert("svg:d", path);
   }
   updateTransformProperties(shape.m_propertyList, state.m_global->m_relativeUnit);
-  listener->insertShape(pos, shape, state.m_graphic);
+  listener->insertShape(pos, shape, state.m_graphic.get());
   if (m_outlinerParaObject)
     sendTextZone(listener, pos, object);
   return true;
@@ -1735,6 +1767,9 @@ bool StarObjectSmallGraphic::send(STOFFListenerPtr &listener, STOFFFrameStyle co
     }
     return false;
   }
+  // in text only mode, the shapes' geometry and style are not retrieved
+  if (object.isTextOnly())
+    return m_graphicState->m_graphic->sendText(listener, pos, object, inMasterPage);
   return m_graphicState->m_graphic->send(listener, pos, object, inMasterPage);
 }
 
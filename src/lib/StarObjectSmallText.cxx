@@ -95,9 +95,11 @@ bool Paragraph::send(STOFFListenerPtr &listener, StarState &mainState, StarState
     return false;
   }
 
+  // in text only mode, the paragraph and the character styles are not retrieved
+  bool textOnly=mainState.m_global->m_object.isTextOnly();
   mainState.m_break=0;
   mainState.m_paragraph=STOFFParagraph();
-  if (mainState.m_global->m_pool && !m_styleName.empty()) { // checkme
+  if (!textOnly && mainState.m_global->m_pool && !m_styleName.empty()) { // checkme
     auto const *style=mainState.m_global->m_pool->findStyleWithFamily(m_styleName, StarItemStyle::F_Paragraph);
     if (style) {
 #if 0
@@ -108,7 +110,7 @@ bool Paragraph::send(STOFFListenerPtr &listener, StarState &mainState, StarState
         done=true;
       }
 #endif
-      for (auto it : style->m_itemSet.m_whichToItemMap) {
+      for (auto const &it : style->m_itemSet.m_whichToItemMap) {
         if (it.second && it.second->m_attribute)
           it.second->m_attribute->addTo(mainState);
       }
@@ -118,18 +120,20 @@ bool Paragraph::send(STOFFListenerPtr &listener, StarState &mainState, StarState
     }
   }
   editState.m_paragraph=mainState.m_paragraph;
-  if (level>=0) editState.m_paragraph.m_listLevelIndex=level;
+  if (level>=0) editState.m_paragraph->m_listLevelIndex=level;
   editState.m_font=mainState.m_font;
-  for (auto it : m_itemSet.m_whichToItemMap) {
-    if (!it.second || !it.second->m_attribute) continue;
+  for (auto const &it : m_itemSet.m_whichToItemMap) {
+    if (textOnly || !it.second || !it.second->m_attribute) continue;
     it.second->m_attribute->addTo(editState);
   }
 #if 0
   std::cerr << "ItemSet:" << m_itemSet.printChild() << "\n";
 #endif
-  STOFFFont mainFont=editState.m_font; // save font
-  listener->setFont(mainFont);
-  listener->setParagraph(editState.m_paragraph);
+  STOFFFont mainFont=editState.m_font.get(); // save font
+  if (!textOnly) {
+    listener->setFont(mainFont);
+    listener->setParagraph(editState.m_paragraph.get());
+  }
 
   std::set<size_t> modPosSet;
   size_t numFonts=m_charItemList.size();
@@ -152,14 +156,15 @@ bool Paragraph::send(STOFFListenerPtr &listener, StarState &mainState, StarState
     }
     std::shared_ptr<SWFieldManagerInternal::Field> field;
     if (fontChange) {
-      STOFFFont &font=editState.m_font;
       editState.reinitializeLineData();
-      font=mainFont;
+      editState.m_font=mainFont;
       for (size_t f=0; f<numFonts; ++f) {
         if (m_charLimitList[f][0]>int(srcPos) || m_charLimitList[f][1]<=int(srcPos))
           continue;
         if (!m_charItemList[f] || !m_charItemList[f]->m_attribute)
           continue;
+        if (textOnly && !m_charItemList[f]->m_attribute->isTextAttribute())
+          continue;
         m_charItemList[f]->m_attribute->addTo(editState);
         if (editState.m_field) {
           if (int(srcPos)==m_charLimitList[f][0])
@@ -172,7 +177,9 @@ bool Paragraph::send(STOFFListenerPtr &listener, StarState &mainState, StarState
         STOFF_DEBUG_MSG(("StarObjectSmallTextInternal::Paragraph::send: sorry, sending content/field/flyCnt/footnote/refMark/link is not implemented\n"));
         first=false;
       }
-      listener->setFont(font);
+      STOFFFont const &font=editState.m_font.get();
+      if (!textOnly)
+        listener->setFont(font);
       if (font.m_lineBreak) {
         listener->insertEOL(true);
         continue;
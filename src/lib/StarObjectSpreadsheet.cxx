@@ -33,6 +33,7 @@
 
 #include <cstring>
 #include <iomanip>
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <set>
@@ -273,6 +274,7 @@ public:
     , m_content()
     , m_textZone()
     , m_hasNote(false)
+    , m_numberingStyleId(0)
   {
     setPosition(pos);
   }
@@ -286,11 +288,110 @@ public:
   bool m_hasNote;
   //! the notes text, date, author
   librevenge::RVNGString m_notes[3];
+  /** the identifier of the numbering style: 0 if the numbering style is empty,
+      see State::getNumberingStyleId */
+  int m_numberingStyleId;
 };
 
 Cell::~Cell()
 {
 }
+////////////////////////////////////////
+//! Internal: the list of columns' attributes of some rows of a StarObjectSpreadsheet
+class ColumnAttributeList
+{
+public:
+  //! an interval of columns (min col, max col) and its attribute
+  typedef std::pair<STOFFVec2i, std::shared_ptr<StarAttribute> > Interval;
+  //! constructor
+  ColumnAttributeList()
+    : m_intervalList()
+  {
+  }
+  //! returns true if no attribute is defined
+  bool empty() const
+  {
+    return !m_intervalList || m_intervalList->empty();
+  }
+  //! returns true if the two lists share the same data
+  bool isSameAs(ColumnAttributeList const &list) const
+  {
+    return m_intervalList==list.m_intervalList;
+  }
+  //! returns the list of intervals sorted by columns
+  std::vector<Interval> const &getIntervals() const
+  {
+    static std::vector<Interval> const emptyList;
+    return m_intervalList ? *m_intervalList : emptyList;
+  }
+  /** sets the attribute of a column, merges it with the adjacent intervals if possible.
+
+      \note the data are duplicated if they are shared with other rows
+   */
+  void set(int column, std::shared_ptr<StarAttribute> const &attribute)
+  {
+    if (!attribute) return;
+    if (!m_intervalList)
+      m_intervalList.reset(new std::vector<Interval>);
+    else if (m_intervalList.use_count()>1)
+      m_intervalList.reset(new std::vector<Interval>(*m_intervalList));
+    auto &list=*m_intervalList;
+    auto it=std::upper_bound(list.begin(), list.end(), column, &compareColumn);
+    if (it!=list.begin()) {
+      auto prevIt=it-1;
+      if (prevIt->first[1]>=column) { // column is in prevIt interval
+        if (prevIt->second.get()==attribute.get()) return;
+        STOFFVec2i const cols=prevIt->first;
+        std::shared_ptr<StarAttribute> prevAttribute=prevIt->second;
+        size_t id=size_t(prevIt-list.begin());
+        list.erase(prevIt);
+        std::vector<Interval> newList;
+        if (cols[0]<column) newList.push_back(Interval(STOFFVec2i(cols[0],column-1), prevAttribute));
+        newList.push_back(Interval(STOFFVec2i(column,column), attribute));
+        if (column<cols[1]) newList.push_back(Interval(STOFFVec2i(column+1,cols[1]), prevAttribute));
+        list.insert(list.begin()+long(id), newList.begin(), newList.end());
+        merge();
+        return;
+      }
+      if (prevIt->first[1]+1==column && prevIt->second.get()==attribute.get()) {
+        ++prevIt->first[1];
+        if (it!=list.end() && it->first[0]==column+1 && it->second.get()==attribute.get()) {
+          prevIt->first[1]=it->first[1];
+          list.erase(it);
+        }
+        return;
+      }
+    }
+    if (it!=list.end() && it->first[0]==column+1 && it->second.get()==attribute.get()) {
+      it->first[0]=column;
+      return;
+    }
+    list.insert(it, Interval(STOFFVec2i(column,column), attribute));
+  }
+protected:
+  //! small function used to find the first interval which begins after a column
+  static bool compareColumn(int column, Interval const &interval)
+  {
+    return column<interval.first[0];
+  }
+  //! merges the adjacent intervals which have the same attribute
+  void merge()
+  {
+    auto &list=*m_intervalList;
+    std::vector<Interval> newList;
+    for (auto const &interval : list) {
+      if (!newList.empty() && newList.back().first[1]+1==interval.first[0] &&
+          newList.back().second.get()==interval.second.get())
+        newList.back().first[1]=interval.first[1];
+      else
+        newList.push_back(interval);
+    }
+    list.swap(newList);
+  }
+  //! the shared intervals list
+  std::shared_ptr<std::vector<Interval> > m_intervalList;
+};
+
 ////////////////////////////////////////
 //! Internal: structure used to store a row of a StarObjectSpreadsheet
 class RowContent
@@ -299,37 +400,13 @@ public:
   //! constructor
   RowContent()
     : m_colToCellMap()
-    , m_colToAttributeMap()
-  {
-  }
-  //! try to compress the item list and create a attribute list
-  void compressItemList()
+    , m_colAttributeList()
   {
-    std::map<STOFFVec2i,std::shared_ptr<StarAttribute> > oldMap=m_colToAttributeMap;
-    std::map<STOFFVec2i,std::shared_ptr<StarAttribute> >::const_iterator it=oldMap.begin();
-    m_colToAttributeMap.clear();
-
-    std::shared_ptr<StarAttribute> actAttribute;
-    STOFFVec2i actPos(0,-1);
-    while (it!=oldMap.end()) {
-      // first check for not filled row
-      std::shared_ptr<StarAttribute> newAttrib=it->second;
-      if (it->first[0]!=actPos[1]+1 || newAttrib.get()!=actAttribute.get()) {
-        if (actAttribute)
-          m_colToAttributeMap[actPos]=actAttribute;
-        actAttribute=newAttrib;
-        actPos=STOFFVec2i(it->first[0], it->first[0]-1);
-      }
-      actPos[1]=it->first[1];
-      ++it;
-    }
-    if (actAttribute)
-      m_colToAttributeMap[actPos]=actAttribute;
   }
   //! map col -> cell
   std::map<int, std::shared_ptr<Cell> > m_colToCellMap;
-  //! map col -> attribute
-  std::map<STOFFVec2i, std::shared_ptr<StarAttribute> > m_colToAttributeMap;
+  //! the columns' attributes (shared with the other rows which have the same attributes)
+  ColumnAttributeList m_colAttributeList;
 };
 
 ////////////////////////////////////////
@@ -346,6 +423,7 @@ public:
     , m_colWidthList()
     , m_rowHeightMap()
     , m_rowToRowContentMap()
+    , m_formulaTemplateMap()
     , m_badCell()
   {
   }
@@ -475,6 +553,8 @@ public:
   std::map<STOFFVec2i, int> m_rowHeightMap;
   //! map (min row, max row) -> rowContent
   std::map<STOFFVec2i, RowContent> m_rowToRowContentMap;
+  //! the formula templates shared by the cells
+  StarCellFormula::TemplateMap m_formulaTemplateMap;
   //! a cell uses to return an empty cell
   Cell m_badCell;
 };
@@ -483,6 +563,45 @@ Table::~Table()
 {
 }
 
+////////////////////////////////////////
+//! Internal: the key used to store a resolved cell style
+struct CellStyleKey {
+  //! constructor
+  CellStyleKey(StarAttribute const *attribute, Cell const &cell)
+    : m_attribute(attribute)
+    , m_format(int(cell.getFormat().m_format), int(cell.getFormat().m_numberFormat))
+    , m_numberingStyleId(cell.m_numberingStyleId)
+  {
+  }
+  //! copy constructor
+  CellStyleKey(CellStyleKey const &) = default;
+  //! copy operator
+  CellStyleKey &operator=(CellStyleKey const &) = default;
+  //! comparison operator
+  bool operator<(CellStyleKey const &key) const
+  {
+    if (m_attribute!=key.m_attribute) return m_attribute<key.m_attribute;
+    if (m_format!=key.m_format) return m_format<key.m_format;
+    return m_numberingStyleId<key.m_numberingStyleId;
+  }
+  //! the attribute
+  StarAttribute const *m_attribute;
+  //! the cell format and number format
+  STOFFVec2i m_format;
+  //! the cell numbering style identifier: the numbering properties are added to this style
+  int m_numberingStyleId;
+};
+
+////////////////////////////////////////
+//! Internal: a comparator of property lists
+struct PropertyListLess {
+  //! comparison operator
+  bool operator()(librevenge::RVNGPropertyList const &list1, librevenge::RVNGPropertyList const &list2) const
+  {
+    return libstoff::comparePropertyList(list1, list2)<0;
+  }
+};
+
 ////////////////////////////////////////
 //! Internal: the state of a StarObjectSpreadsheet
 struct State {
@@ -492,8 +611,20 @@ struct State {
     , m_tableList()
     , m_sheetNames()
     , m_pageStyle("")
+    , m_cellStyleMap()
+    , m_numberingStyleIdMap()
   {
   }
+  //! returns the identifier of a numbering style, 0 for an empty style
+  int getNumberingStyleId(librevenge::RVNGPropertyList const &numberingStyle)
+  {
+    if (numberingStyle.empty()) return 0;
+    auto it=m_numberingStyleIdMap.find(numberingStyle);
+    if (it!=m_numberingStyleIdMap.end()) return it->second;
+    int id=int(m_numberingStyleIdMap.size())+1;
+    m_numberingStyleIdMap[numberingStyle]=id;
+    return id;
+  }
   //! the model
   std::shared_ptr<StarObjectModel> m_model;
   //! the actual table
@@ -502,6 +633,11 @@ struct State {
   std::vector<librevenge::RVNGString> m_sheetNames;
   //! the main page style
   librevenge::RVNGString m_pageStyle;
+  /** the resolved cell styles: the attribute and the cell's original format -> a cell which stores
+      the font, the cell style, the format and the numbering style, and the numbering style identifier */
+  std::map<CellStyleKey, std::pair<STOFFCell, int> > m_cellStyleMap;
+  //! the numbering styles of the resolved cell styles -> identifier
+  std::map<librevenge::RVNGPropertyList, int, PropertyListLess> m_numberingStyleIdMap;
 };
 
 ////////////////////////////////////////
@@ -588,7 +724,7 @@ bool StarObjectSpreadsheet::updatePageSpans(std::vector<STOFFPageSpan> &pageSpan
       state.m_global->m_page=STOFFPageSpan();
       state.m_global->m_page.m_pageSpan=nPages;
       if (style) {
-        for (auto it : style->m_itemSet.m_whichToItemMap) {
+        for (auto const &it : style->m_itemSet.m_whichToItemMap) {
           if (it.second && it.second->m_attribute)
             it.second->m_attribute->addTo(state);
         }
@@ -611,6 +747,9 @@ bool StarObjectSpreadsheet::send(STOFFSpreadsheetListenerPtr listener)
     STOFF_DEBUG_MSG(("StarObjectSpreadsheet::send: can not find the table\n"));
     return false;
   }
+  // the numbering styles of the cell styles are defined in the listener
+  m_spreadsheetState->m_cellStyleMap.clear();
+  m_spreadsheetState->m_numberingStyleIdMap.clear();
   // first creates the list of sheet names
   m_spreadsheetState->m_sheetNames.clear();
   for (auto const &t : m_spreadsheetState->m_tableList) {
@@ -672,15 +811,15 @@ bool StarObjectSpreadsheet::sendRow(int table, int row, STOFFSpreadsheetListener
   auto &sheet=*m_spreadsheetState->m_tableList[size_t(table)];
   auto *rowC=sheet.getRow(row);
   if (!rowC) return true;
-  rowC->compressItemList();
 
   // we need to go through the row style list and the cell list in parallel
   bool checkStyle=false;
   int actStyleCol=0;
-  std::map<STOFFVec2i, std::shared_ptr<StarAttribute> >::const_iterator sIt;
-  if (!rowC->m_colToAttributeMap.empty()) {
+  auto const &styleList=rowC->m_colAttributeList.getIntervals();
+  auto sIt=styleList.begin();
+  // in text only mode, the cells' attributes are ignored
+  if (sIt!=styleList.end() && !isTextOnly()) {
     checkStyle=true;
-    sIt=rowC->m_colToAttributeMap.begin();
     actStyleCol=sIt->first[0];
   }
   bool checkCell=false;
@@ -695,7 +834,7 @@ bool StarObjectSpreadsheet::sendRow(int table, int row, STOFFSpreadsheetListener
     int newCol=checkCell ? cIt->first : -1;
     if (checkStyle && sIt->first[1] < actStyleCol) {
       ++sIt;
-      checkStyle=sIt!=rowC->m_colToAttributeMap.end();
+      checkStyle=sIt!=styleList.end();
       actStyleCol=checkStyle ? sIt->first[0] : -1;
     }
     if (checkStyle && (!checkCell || actStyleCol<newCol)) {
@@ -726,15 +865,35 @@ bool StarObjectSpreadsheet::sendCell(StarObjectSpreadsheetInternal::Cell &cell,
     return false;
   }
   if (attrib) {
-    auto pool=findItemPool(StarItemPool::T_SpreadsheetPool, false);
-    StarState state(pool.get(), *this);
-    attrib->addTo(state);
-    cell.setFont(state.m_font);
-    cell.setCellStyle(state.m_cell);
-    // checkme: we need the pool here
-    getFormatManager()->updateNumberingProperties(cell);
-  }
-  if (!cell.m_content.m_formula.empty())
+    // the style only depends on the attribute and on the cell format and numbering style, so resolve it once
+    StarObjectSpreadsheetInternal::CellStyleKey key(attrib, cell);
+    auto &styleMap=m_spreadsheetState->m_cellStyleMap;
+    auto it=styleMap.find(key);
+    if (it==styleMap.end()) {
+      STOFFCell styleCell;
+      styleCell.setFormat(cell.getFormat());
+      styleCell.setNumberingStyle(cell.getNumberingStyle());
+      auto pool=findItemPool(StarItemPool::T_SpreadsheetPool, false);
+      StarState state(pool.get(), *this);
+      attrib->addTo(state);
+      styleCell.setFont(state.m_font.get());
+      styleCell.setCellStyle(state.m_cell.get());
+      // checkme: we need the pool here
+      getFormatManager()->updateNumberingProperties(styleCell);
+      if (!styleCell.getFormat().hasBasicFormat())
+        styleCell.setNumberingStyleName(listener->defineSheetNumberingStyle(styleCell.getNumberingStyle()));
+      int numberingStyleId=m_spreadsheetState->getNumberingStyleId(styleCell.getNumberingStyle());
+      it=styleMap.insert(std::make_pair(key, std::make_pair(styleCell, numberingStyleId))).first;
+    }
+    STOFFCell const &styleCell=it->second.first;
+    cell.setFont(styleCell.getFont());
+    cell.setCellStyle(styleCell.getCellStyle());
+    cell.setFormat(styleCell.getFormat());
+    cell.setNumberingStyle(styleCell.getNumberingStyle());
+    cell.setNumberingStyleName(styleCell.getNumberingStyleName());
+    cell.m_numberingStyleId=it->second.second;
+  }
+  if (cell.m_content.hasFormula())
     StarCellFormula::updateFormula(cell.m_content, m_spreadsheetState->m_sheetNames, table);
 
   listener->openSheetCell(cell, cell.m_content, numRepeated);
@@ -747,6 +906,8 @@ bool StarObjectSpreadsheet::sendCell(StarObjectSpreadsheetInternal::Cell &cell,
     listener->insertComment(subDoc, cell.m_notes[2], cell.m_notes[1]);
   }
   listener->closeSheetCell();
+  if (cell.m_content.m_formulaTemplate) // the expanded formula is no longer needed
+    std::vector<STOFFCellContent::FormulaInstruction>().swap(cell.m_content.m_formula);
   return true;
 }
 
@@ -1355,6 +1516,10 @@ try
     case 0x4223: {
       // sc_documen9.cxx ScDocument::LoadDrawLayer, sc_drwlayer.cxx ScDrawLayer::Load
       f << "drawing,";
+      if (isTextOnly()) { // the drawing layer is not needed to retrieve the text
+        input->seek(endPos, librevenge::RVNG_SEEK_SET);
+        break;
+      }
       while (input->tell()<endPos) {
         ascFile.addPos(pos);
         ascFile.addNote(f.str().c_str());
@@ -2162,15 +2327,26 @@ bool StarObjectSpreadsheet::readSCColumn(StarZone &zone, StarObjectSpreadsheetIn
         }
 #if 0
         libstoff::DebugStream f2;
-        std::set<StarAttribute const *> done;
+        StarAttributeDoneSet done;
         item->m_attribute->print(f2, done);
         std::cerr << "\tC" << column << "x" << STOFFVec2i(row, newRow) << ":" << f2.str().c_str() << "[" << item->m_attribute.get() << "]\n";
 #endif
         if (newRow>=row) {
           table.updateRowsBlocks(STOFFVec2i(row, newRow));
           auto it= table.m_rowToRowContentMap.lower_bound(STOFFVec2i(-1,row));
+          // the blocks which shared the same list before the change can share the modified list
+          StarObjectSpreadsheetInternal::ColumnAttributeList oldList, newList;
+          bool hasOldList=false;
           while (it!=table.m_rowToRowContentMap.end() && it->first[1]<=newRow) {
-            it->second.m_colToAttributeMap[STOFFVec2i(column, column)]=item->m_attribute;
+            auto &attributeList=it->second.m_colAttributeList;
+            if (hasOldList && attributeList.isSameAs(oldList))
+              attributeList=newList;
+            else {
+              oldList=attributeList;
+              attributeList.set(column, item->m_attribute);
+              newList=attributeList;
+              hasOldList=true;
+            }
             ++it;
           }
           row=newRow+1;
@@ -2213,8 +2389,43 @@ bool StarObjectSpreadsheet::readSCData(StarZone &zone, StarObjectSpreadsheetInte
 
   long lastPos=zone.getRecordLastPosition();
   int const version=table.getLoadingVersion();
+  // a value cell: row, type=1, [flags if version>=7], double
+  int const valueSize=version>=7 ? 12 : 11;
+  bool const littleEndian=input->readInverted();
   for (int i=0; i<count; ++i) {
     pos=input->tell();
+    // fast path: the value cells which are the most frequent cells
+    while (i<count && pos+valueSize<=lastPos) {
+      unsigned long numRead;
+      uint8_t const *data=input->read(size_t(valueSize), numRead);
+      if (!data || long(numRead)!=valueSize || data[2]!=1 || (version>=7 && (data[3]&0xf))) {
+        input->seek(pos, librevenge::RVNG_SEEK_SET);
+        break;
+      }
+      int row=littleEndian ? (int(data[1])<<8)|int(data[0]) : (int(data[0])<<8)|int(data[1]);
+      double value;
+      bool isNan;
+      if (!STOFFInputStream::decodeDoubleReverted8(data+valueSize-8, value, isNan)) {
+        STOFF_DEBUG_MSG(("StarObjectSpreadsheet::readSCData: can not read a double\n"));
+        value=0;
+      }
+      auto &cell=table.getCell(STOFFVec2i(column, row));
+      STOFFCell::Format format=cell.getFormat();
+      format.m_format=STOFFCell::F_NUMBER;
+      cell.setFormat(format);
+      cell.m_content.m_contentType=STOFFCellContent::C_NUMBER;
+      cell.m_content.setValue(value);
+#ifdef DEBUG_WITH_FILES
+      f.str("");
+      f << "SCData-" << i << ":row=" << row << ",value,val=" << value << ",";
+      ascFile.addPos(pos);
+      ascFile.addNote(f.str().c_str());
+#endif
+      pos+=valueSize;
+      ++i;
+    }
+    if (i>=count)
+      break;
     f.str("");
     f << "SCData-" << i << ":";
     if (input->tell()+4>lastPos) {
@@ -2329,6 +2540,7 @@ bool StarObjectSpreadsheet::readSCData(StarZone &zone, StarObjectSpreadsheetInte
           input->seek(endDataPos, librevenge::RVNG_SEEK_SET);
           break;
         }
+        table.m_formulaTemplateMap.share(cell.m_content, STOFFVec2i(column, row));
         pos=input->tell();
         if ((cFlags&3)==1 && input->tell()<endDataPos)
           f << "cols=" << input->readULong(2) << ",rows=" << input->readULong(2) << ",";
@@ -2340,6 +2552,8 @@ bool StarObjectSpreadsheet::readSCData(StarZone &zone, StarObjectSpreadsheetInte
         *input>>codeLen;
         if (codeLen && (!StarCellFormula::readSCFormula3(zone, cell.m_content, version, endDataPos) || input->tell()>endDataPos))
           f << "###";
+        else
+          table.m_formulaTemplateMap.share(cell.m_content, STOFFVec2i(column, row));
       }
       if (input->tell()!=endDataPos) {
         f << "##";
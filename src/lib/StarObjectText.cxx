@@ -31,6 +31,7 @@
 * instead of those above.
 */
 
+#include <algorithm>
 #include <cstring>
 #include <iomanip>
 #include <iostream>
@@ -207,9 +208,9 @@ bool GraphZone::send(STOFFListenerPtr &listener, StarState &state) const
     STOFF_DEBUG_MSG(("StarObjectTextInternal: sorry, can not find object %s\n", m_names[0].cstr()));
     return false;
   }
-  STOFFGraphicStyle style=state.m_graphic;
-  state.m_frame.addTo(style.m_propertyList);
-  listener->insertPicture(state.m_frame, localPicture, style);
+  STOFFGraphicStyle style=state.m_graphic.get();
+  state.m_frame.get().addTo(style.m_propertyList);
+  listener->insertPicture(state.m_frame.get(), localPicture, style);
   return true;
 }
 
@@ -251,18 +252,18 @@ bool OLEZone::send(STOFFListenerPtr &listener, StarState &state) const
   STOFFEmbeddedObject localPicture;
   std::shared_ptr<StarObject> localObj;
   auto dir=m_oleParser->getDirectory(m_name.cstr());
-  STOFFGraphicStyle style=state.m_graphic;
-  state.m_frame.addTo(style.m_propertyList);
+  STOFFGraphicStyle style=state.m_graphic.get();
+  state.m_frame.get().addTo(style.m_propertyList);
   if (!dir || !StarFileManager::readOLEDirectory(m_oleParser, dir, localPicture, localObj) || localPicture.isEmpty()) {
     if (!localObj) {
       STOFF_DEBUG_MSG(("StarObjectTextInternal::OLEZone::send: sorry, can not find object %s\n", m_name.cstr()));
       return false;
     }
     auto chart=std::dynamic_pointer_cast<StarObjectChart>(localObj);
-    if (chart && chart->send(listener, state.m_frame, style))
+    if (chart && chart->send(listener, state.m_frame.get(), style))
       return true;
     auto math=std::dynamic_pointer_cast<StarObjectMath>(localObj);
-    if (math && math->send(listener, state.m_frame, style))
+    if (math && math->send(listener, state.m_frame.get(), style))
       return true;
     if (std::dynamic_pointer_cast<StarObjectText>(localObj)) {
       STOFF_DEBUG_MSG(("StarObjectTextInternal::OLEZone::send: sorry, unsure how to send a text object %s\n", m_name.cstr()));
@@ -272,7 +273,7 @@ bool OLEZone::send(STOFFListenerPtr &listener, StarState &state) const
     }
     return false;
   }
-  listener->insertPicture(state.m_frame, localPicture, style);
+  listener->insertPicture(state.m_frame.get(), localPicture, style);
 
   return true;
 }
@@ -325,14 +326,133 @@ bool SectionZone::send(STOFFListenerPtr &listener, StarState &state) const
   return true;
 }
 
+////////////////////////////////////////
+/** Internal: small class used to retrieve the character attributes
+    which cover a position, the positions being given in increasing
+    order
+
+    \note an attribute with position (p0,p1) covers [p0,p1[, a negative
+    p0 meaning from the beginning, a negative p1 meaning to the end
+    excepted if p0 is positive: in this case, the attribute only covers
+    p0
+ */
+struct CharAttributeSweep {
+  //! constructor
+  explicit CharAttributeSweep(std::vector<StarWriterStruct::Attribute> const &list)
+    : m_list(list)
+    , m_eventList()
+    , m_nextEvent(0)
+    , m_lastPosition(-1)
+    , m_activeSet()
+  {
+    for (size_t i=0; i<list.size(); ++i) {
+      auto const &attrib=list[i];
+      if (!attrib.m_attribute)
+        continue;
+      int const &minPos=attrib.m_position[0];
+      int const &maxPos=attrib.m_position[1];
+      if (minPos>=0 && maxPos>=0 && maxPos<=minPos)
+        continue;
+      if (minPos>=0)
+        m_eventList.push_back(Event(minPos, i, false));
+      if (maxPos>=0)
+        m_eventList.push_back(Event(maxPos, i, true));
+      else if (minPos>=0)
+        m_eventList.push_back(Event(minPos+1, i, true));
+    }
+    std::sort(m_eventList.begin(), m_eventList.end(),
+    [](Event const &a, Event const &b) {
+      return a.m_position<b.m_position;
+    });
+    reset();
+  }
+  //! returns the ordered list of the attributes' index which cover a position
+  std::set<size_t> const &getActiveSet(int pos)
+  {
+    if (pos<m_lastPosition)
+      reset();
+    m_lastPosition=pos;
+    while (m_nextEvent<m_eventList.size() && m_eventList[m_nextEvent].m_position<=pos) {
+      auto const &event=m_eventList[m_nextEvent++];
+      if (event.m_end)
+        m_activeSet.erase(event.m_id);
+      else
+        m_activeSet.insert(event.m_id);
+    }
+    return m_activeSet;
+  }
+protected:
+  //! restarts the sweep from the beginning
+  void reset()
+  {
+    m_nextEvent=0;
+    m_lastPosition=-1;
+    m_activeSet.clear();
+    for (size_t i=0; i<m_list.size(); ++i) {
+      if (m_list[i].m_attribute && m_list[i].m_position[0]<0)
+        m_activeSet.insert(i);
+    }
+  }
+  //! an attribute start or end
+  struct Event {
+    //! constructor
+    Event(int pos, size_t id, bool end)
+      : m_position(pos)
+      , m_id(id)
+      , m_end(end)
+    {
+    }
+    //! the position
+    int m_position;
+    //! the attribute index
+    size_t m_id;
+    //! true if the attribute ends at this position
+    bool m_end;
+  };
+  //! the attribute list
+  std::vector<StarWriterStruct::Attribute> const &m_list;
+  //! the start/end events sorted by position
+  std::vector<Event> m_eventList;
+  //! the next event to treat
+  size_t m_nextEvent;
+  //! the last position
+  int m_lastPosition;
+  //! the index of the attributes which cover the last position
+  std::set<size_t> m_activeSet;
+};
+
+////////////////////////////////////////
+//! Internal: a block of memory which stores the text of consecutive paragraphs
+struct TextBlock {
+  //! constructor
+  TextBlock()
+    : m_text()
+    , m_textSourcePosition()
+  {
+  }
+  //! returns true if n more characters can be added in this block
+  bool canStore(size_t n) const
+  {
+    return m_text.empty() || m_text.size()+n<=s_maximalSize;
+  }
+  //! the maximal number of characters of a block (excepted for a very long paragraph)
+  static size_t const s_maximalSize=0x8000;
+  //! the text
+  std::vector<uint32_t> m_text;
+  //! the text initial position
+  std::vector<size_t> m_textSourcePosition;
+};
+
 ////////////////////////////////////////
 //! Internal: a textZone of StarObjectTextInteral
 struct TextZone final : public Zone {
   //! constructor
   TextZone()
     : Zone()
-    , m_text()
-    , m_textSourcePosition()
+    , m_textBlock()
+    , m_textBegin(0)
+    , m_textLength(0)
+    , m_sourcePositionLength(0)
     , m_styleName("")
     , m_level(-1)
     , m_charAttributeList()
@@ -345,10 +465,24 @@ struct TextZone final : public Zone {
   void inventoryPage(StarState &state) const final;
   //! try to send the data to a listener
   bool send(STOFFListenerPtr &listener, StarState &state) const final;
-  //! the text
-  std::vector<uint32_t> m_text;
-  //! the text initial position
-  std::vector<size_t> m_textSourcePosition;
+  //! returns the c^th character
+  uint32_t getCharacter(size_t c) const
+  {
+    return m_textBlock->m_text[m_textBegin+c];
+  }
+  //! returns the initial position of the c^th character (c must be less than m_sourcePositionLength)
+  size_t getSourcePosition(size_t c) const
+  {
+    return m_textBlock->m_textSourcePosition[m_textBegin+c];
+  }
+  //! the block which stores the text (shared with the other paragraphs)
+  std::shared_ptr<TextBlock> m_textBlock;
+  //! the position of the text in the block
+  size_t m_textBegin;
+  //! the number of characters
+  size_t m_textLength;
+  //! the number of characters whose initial position is known
+  size_t m_sourcePositionLength;
   //! the style name
   librevenge::RVNGString m_styleName;
   //! the level -1=none, 200: keep in list with no bullet
@@ -372,7 +506,7 @@ void TextZone::inventoryPage(StarState &state) const
     if (state.m_global->m_pool && !m_styleName.empty()) { // checkme
       auto const *style=state.m_global->m_pool->findStyleWithFamily(m_styleName, StarItemStyle::F_Paragraph);
       if (style) {
-        for (auto it : style->m_itemSet.m_whichToItemMap) {
+        for (auto const &it : style->m_itemSet.m_whichToItemMap) {
           if (it.second && it.second->m_attribute)
             it.second->m_attribute->addTo(state);
         }
@@ -405,20 +539,22 @@ bool TextZone::send(STOFFListenerPtr &listener, StarState &state) const
     return false;
   }
 
-  if (m_list) state.m_global->m_list=listener->getListManager()->addList(m_list);
+  // in text only mode, the paragraph and the character styles are not retrieved
+  bool textOnly=state.m_global->m_object.isTextOnly();
+  if (m_list && !textOnly) state.m_global->m_list=listener->getListManager()->addList(m_list);
   size_t numPages=state.m_global->m_pageNameList.size();
   if (state.m_styleName!=m_styleName) {
     state.reinitializeLineData();
     state.m_paragraph=STOFFParagraph();
     state.m_styleName=m_styleName;
-    if (state.m_global->m_pool && !m_styleName.empty()) { // checkme
+    if (!textOnly && state.m_global->m_pool && !m_styleName.empty()) { // checkme
       StarItemStyle const *style=state.m_global->m_pool->findStyleWithFamily(m_styleName, StarItemStyle::F_Paragraph);
       if (style) {
         if (style->m_outlineLevel>=0 && style->m_outlineLevel<20) {
-          state.m_paragraph.m_outline=true;
-          state.m_paragraph.m_listLevelIndex=style->m_outlineLevel+1;
+          state.m_paragraph->m_outline=true;
+          state.m_paragraph->m_listLevelIndex=style->m_outlineLevel+1;
         }
-        for (auto it : style->m_itemSet.m_whichToItemMap) {
+        for (auto const &it : style->m_itemSet.m_whichToItemMap) {
           if (it.second && it.second->m_attribute)
             it.second->m_attribute->addTo(state);
         }
@@ -431,8 +567,9 @@ bool TextZone::send(STOFFListenerPtr &listener, StarState &state) const
       }
     }
   }
-  STOFFFont mainFont=state.m_font;
-  listener->setFont(mainFont);
+  STOFFFont mainFont=state.m_font.get();
+  if (!textOnly)
+    listener->setFont(mainFont);
   if (!m_markList.empty()) {
     static bool first=true;
     if (first) {
@@ -463,9 +600,9 @@ bool TextZone::send(STOFFListenerPtr &listener, StarState &state) const
     // either a paragraph anchor or a "at char" anchor
     StarState fState(state);
     c->updateState(fState);
-    size_t lastIndex=m_textSourcePosition.empty() ? 0 : m_textSourcePosition.back();
-    size_t cPos=fState.m_frame.m_anchorIndex<0 ? 0 : fState.m_frame.m_anchorIndex>int(lastIndex) ? lastIndex :
-                size_t(fState.m_frame.m_anchorIndex);
+    size_t lastIndex=m_sourcePositionLength==0 ? 0 : getSourcePosition(m_sourcePositionLength-1);
+    size_t cPos=fState.m_frame.get().m_anchorIndex<0 ? 0 : fState.m_frame.get().m_anchorIndex>int(lastIndex) ? lastIndex :
+                size_t(fState.m_frame.get().m_anchorIndex);
     posToFormat.insert(std::multimap<size_t, std::shared_ptr<StarFormatManagerInternal::FormatDef> >::value_type(cPos, c));
   }
   auto posSetIt=modPosSet.begin();
@@ -474,9 +611,10 @@ bool TextZone::send(STOFFListenerPtr &listener, StarState &state) const
   StarState lineState(state);
   state.m_break=0;
   bool newPage=false;
-  for (size_t c=0; c<= m_text.size(); ++c) {
+  CharAttributeSweep attributeSweep(m_charAttributeList);
+  for (size_t c=0; c<= m_textLength; ++c) {
     bool fontChange=false;
-    size_t srcPos=c<m_textSourcePosition.size() ? m_textSourcePosition[c] : m_textSourcePosition.empty() ? 0 : 10000;
+    size_t srcPos=c<m_sourcePositionLength ? getSourcePosition(c) : m_sourcePositionLength==0 ? 0 : 10000;
     while (posSetIt!=modPosSet.end() && *posSetIt <= srcPos) {
       ++posSetIt;
       fontChange=true;
@@ -491,13 +629,9 @@ bool TextZone::send(STOFFListenerPtr &listener, StarState &state) const
     if (fontChange) {
       lineState.reinitializeLineData();
       lineState.m_font=mainFont;
-      STOFFFont &font=lineState.m_font;
-      for (auto const &attrib : m_charAttributeList) {
-        if ((attrib.m_position[1]<0 && attrib.m_position[0]>=0 && attrib.m_position[0]!=int(srcPos)) ||
-            (attrib.m_position[0]>=0 && attrib.m_position[0]>int(srcPos)) ||
-            (attrib.m_position[1]>=0 && attrib.m_position[1]<=int(srcPos)))
-          continue;
-        if (!attrib.m_attribute)
+      for (auto id : attributeSweep.getActiveSet(int(srcPos))) {
+        auto const &attrib=m_charAttributeList[id];
+        if (textOnly && !attrib.m_attribute->isTextAttribute())
           continue;
         attrib.m_attribute->addTo(lineState);
         if (!footnote && lineState.m_footnote)
@@ -552,29 +686,31 @@ bool TextZone::send(STOFFListenerPtr &listener, StarState &state) const
           lineState.m_refMark.clear();
         }
       }
+      STOFFFont const &font=lineState.m_font.get();
       softHyphen=font.m_softHyphen;
       hardBlank=font.m_hardBlank;
-      listener->setFont(font);
-      if (c==0) {
+      if (!textOnly)
+        listener->setFont(font);
+      if (c==0 && !textOnly) {
         int level=m_level;
         if (level==200) {
           level=state.m_global->m_listLevel;
-          lineState.m_paragraph.m_bulletVisible=true; // useMe
+          lineState.m_paragraph->m_bulletVisible=true; // useMe
         }
-        if (!lineState.m_paragraph.m_outline) {
+        if (!lineState.m_paragraph.get().m_outline) {
           if (level>=0 && (!state.m_global->m_list || state.m_global->m_list->numLevels()<=int(level))) {
             STOFF_DEBUG_MSG(("StarObjectTextInternal::TextZone::send: oops can not find the list\n"));
             level=-1;
           }
           if (level>=0) {
-            lineState.m_paragraph.m_listLevel = state.m_global->m_list->getLevel(level);
-            lineState.m_paragraph.m_listId = state.m_global->m_list->getId();
-            lineState.m_paragraph.m_listLevelIndex = level+1;
+            lineState.m_paragraph->m_listLevel = state.m_global->m_list->getLevel(level);
+            lineState.m_paragraph->m_listId = state.m_global->m_list->getId();
+            lineState.m_paragraph->m_listLevelIndex = level+1;
           }
           else
-            lineState.m_paragraph.m_listLevelIndex=0;
+            lineState.m_paragraph->m_listLevelIndex=0;
         }
-        listener->setParagraph(lineState.m_paragraph);
+        listener->setParagraph(lineState.m_paragraph.get());
       }
       static bool first=true;
       if (first && lineState.m_content) {
@@ -623,18 +759,18 @@ bool TextZone::send(STOFFListenerPtr &listener, StarState &state) const
       StarState cState(*state.m_global);
       field->send(listener, cState);
     }
-    else if (c==m_text.size())
+    else if (c==m_textLength)
       break;
     else if (hardBlank)
       listener->insertUnicode(0xa0);
     else if (softHyphen)
       listener->insertUnicode(0xad);
-    else if (m_text[c]==0x9)
+    else if (getCharacter(c)==0x9)
       listener->insertTab();
-    else if (m_text[c]==0xa)
+    else if (getCharacter(c)==0xa)
       listener->insertEOL(true);
     else
-      listener->insertUnicode(m_text[c]);
+      listener->insertUnicode(getCharacter(c));
   }
   if (endLinkPos>=0) // check that not link is opened
     listener->closeLink();
@@ -687,9 +823,9 @@ bool Content::send(STOFFListenerPtr &listener, StarState &state, bool isFlyer) c
         continue;
       StarState cState(state.m_global);
       auto subDoc = std::make_shared<SubDocument>(*this, cState);
-      STOFFGraphicStyle style=cState.m_graphic;
-      state.m_frame.addTo(style.m_propertyList);
-      listener->insertTextBox(state.m_frame, subDoc, style);
+      STOFFGraphicStyle style=cState.m_graphic.get();
+      state.m_frame.get().addTo(style.m_propertyList);
+      listener->insertTextBox(state.m_frame.get(), subDoc, style);
       return true;
     }
   }
@@ -704,6 +840,61 @@ bool Content::send(STOFFListenerPtr &listener, StarState &state, bool isFlyer) c
   return true;
 }
 
+////////////////////////////////////////
+//! Internal: a content which inventories the pages of its zones when they are read, and stores them in another content (if it exists)
+struct InventoryContent final : public Content {
+  //! constructor
+  explicit InventoryContent(StarState &state, std::shared_ptr<Content> content=std::shared_ptr<Content>())
+    : Content()
+    , m_state(state)
+    , m_content(content)
+  {
+  }
+  //! inventories the page of a zone
+  void addZone(std::shared_ptr<Zone> zone) final
+  {
+    if (m_content)
+      m_content->addZone(zone);
+    if (!m_state.m_global->m_pool)
+      return;
+    if (zone)
+      zone->inventoryPage(m_state);
+    if (m_state.m_global->m_pageNameList.empty())
+      m_state.m_global->m_pageNameList.push_back("");
+  }
+  //! the state
+  StarState &m_state;
+  //! the content which stores the zones (or null)
+  std::shared_ptr<Content> m_content;
+};
+
+////////////////////////////////////////
+//! Internal: a content which sends its zones when they are read, and forgets them
+struct SendingContent final : public Content {
+  //! constructor
+  SendingContent(STOFFListenerPtr &listener, StarState &state)
+    : Content()
+    , m_listener(listener)
+    , m_state(state)
+    , m_numZones(0)
+  {
+  }
+  //! sends a zone
+  void addZone(std::shared_ptr<Zone> zone) final
+  {
+    if (m_numZones++)
+      m_listener->insertEOL();
+    if (zone)
+      zone->send(m_listener, m_state);
+  }
+  //! the listener
+  STOFFListenerPtr &m_listener;
+  //! the state
+  StarState &m_state;
+  //! the number of zones already sent
+  size_t m_numZones;
+};
+
 ////////////////////////////////////////
 //! Internal: the state of a StarObjectText
 struct State {
@@ -712,18 +903,60 @@ struct State {
     : m_numPages(0)
     , m_numGraphicPages(0)
     , m_mainContent()
+    , m_mainContentZone()
+    , m_mainContentPos(0)
+    , m_pageInventoryDone(false)
+    , m_pageNameList()
+    , m_textBlock()
+    , m_readText()
+    , m_readTextSourcePosition()
     , m_flyList()
     , m_numericRuler()
     , m_pageStyle()
     , m_model()
   {
   }
+  //! stores the last read text in a text block and updates the zone
+  void storeReadText(TextZone &zone)
+  {
+    size_t n=m_readText.size();
+    if (n==0) return;
+    if (!m_textBlock || !m_textBlock->canStore(n))
+      m_textBlock.reset(new TextBlock);
+    zone.m_textBlock=m_textBlock;
+    zone.m_textBegin=m_textBlock->m_text.size();
+    zone.m_textLength=n;
+    zone.m_sourcePositionLength=std::min(n, m_readTextSourcePosition.size());
+    m_textBlock->m_text.insert(m_textBlock->m_text.end(), m_readText.begin(), m_readText.end());
+    m_textBlock->m_textSourcePosition.insert(m_textBlock->m_textSourcePosition.end(), m_readTextSourcePosition.begin(),
+        m_readTextSourcePosition.begin()+std::ptrdiff_t(zone.m_sourcePositionLength));
+    // keep the two vectors aligned, the missing positions are never read
+    m_textBlock->m_textSourcePosition.resize(m_textBlock->m_text.size(), 0);
+  }
+  //! the minimal size of a main content which is not stored
+  static long const s_minStreamedContentSize=0x80000;
   //! the number of pages
   int m_numPages;
   //! the graphic number of pages
   int m_numGraphicPages;
   //! the main content
   std::shared_ptr<Content> m_mainContent;
+  /** the zone which contains the main content, when the main content
+      is too big to be stored: it is read again when needed */
+  std::shared_ptr<StarZone> m_mainContentZone;
+  //! the position of the main content in m_mainContentZone
+  long m_mainContentPos;
+  //! a flag to know if the pages of the main content are inventoried while reading it
+  bool m_pageInventoryDone;
+  //! the list of page names found in the main content
+  std::vector<librevenge::RVNGString> m_pageNameList;
+  /** the block used to store the text of the next paragraphs: a block
+      is freed when all its paragraphs are freed */
+  std::shared_ptr<TextBlock> m_textBlock;
+  //! the buffer used to read the text of a paragraph
+  std::vector<uint32_t> m_readText;
+  //! the buffer used to read the text initial position of a paragraph
+  std::vector<size_t> m_readTextSourcePosition;
   //! the list of fly zone
   std::vector<std::shared_ptr<StarFormatManagerInternal::FormatDef> > m_flyList;
   //! the numeric ruler
@@ -760,8 +993,14 @@ bool StarObjectText::updatePageSpans(std::vector<STOFFPageSpan> &pageSpan, int &
   auto pool=findItemPool(StarItemPool::T_WriterPool, false);
   StarState state(pool.get(), *this);
   state.m_global->m_objectModel=m_textState->m_model;
-  if (m_textState->m_mainContent)
+  if (m_textState->m_pageInventoryDone)
+    state.m_global->m_pageNameList=m_textState->m_pageNameList;
+  else if (m_textState->m_mainContent)
     m_textState->m_mainContent->inventoryPages(state);
+  else if (m_textState->m_mainContentZone) {
+    StarObjectTextInternal::InventoryContent content(state);
+    readMainContent(content);
+  }
   if (m_textState->m_pageStyle)
     m_textState->m_pageStyle->updatePageSpans(state.m_global->m_pageNameList, pageSpan, numPages);
   else {
@@ -785,7 +1024,7 @@ bool StarObjectText::sendPages(STOFFTextListenerPtr &listener)
     STOFF_DEBUG_MSG(("StarObjectText::sendPages: can not find the listener\n"));
     return false;
   }
-  if (!m_textState->m_mainContent) {
+  if (!m_textState->m_mainContent && !m_textState->m_mainContentZone) {
     STOFF_DEBUG_MSG(("StarObjectText::sendPages: can not find any content\n"));
     return true;
   }
@@ -809,8 +1048,14 @@ bool StarObjectText::sendPages(STOFFTextListenerPtr &listener)
   state.m_global->m_objectModel=m_textState->m_model;
   state.m_global->m_numericRuler=m_textState->m_numericRuler;
   STOFFListenerPtr basicListener(listener);
-  m_textState->m_mainContent->send(basicListener, state);
-  return true;
+  if (m_textState->m_mainContent) {
+    m_textState->m_mainContent->send(basicListener, state);
+    return true;
+  }
+  // the main content was not stored, send its zones while reading them
+  StarState cState(state.m_global);
+  StarObjectTextInternal::SendingContent content(basicListener, cState);
+  return readMainContent(content);
 }
 
 ////////////////////////////////////////////////////////////
@@ -843,6 +1088,10 @@ bool StarObjectText::parse()
     else
       base = name.substr(pos+1);
     ole->setReadInverted(true);
+    if (isTextOnly() && (base=="SwNumRules" || base=="SwPageStyleSheets" || base=="DrawingLayer")) {
+      // the numbering, the page styles and the drawing layer are not needed to retrieve the text
+      continue;
+    }
     if (base=="SwNumRules") {
       try {
         StarZone zone(ole, name, "StarNumericList", getPassword());
@@ -956,6 +1205,39 @@ bool StarObjectText::readSfxStyleSheets(STOFFInputStreamPtr input, std::string c
 //
 ////////////////////////////////////////////////////////////
 bool StarObjectText::readSWContent(StarZone &zone, std::shared_ptr<StarObjectTextInternal::Content> &content)
+{
+  if (content) {
+    STOFF_DEBUG_MSG(("StarObjectText::readSWContent: oops, the content zone is already created\n"));
+    return readSWContent(zone, *content);
+  }
+  std::shared_ptr<StarObjectTextInternal::Content> newContent(new StarObjectTextInternal::Content);
+  if (!readSWContent(zone, *newContent))
+    return false;
+  content=newContent;
+  return true;
+}
+
+bool StarObjectText::readMainContent(StarObjectTextInternal::Content &content)
+{
+  if (!m_textState->m_mainContentZone) {
+    STOFF_DEBUG_MSG(("StarObjectText::readMainContent: can not find the main content zone\n"));
+    return false;
+  }
+  auto &zone=*m_textState->m_mainContentZone;
+  zone.input()->seek(m_textState->m_mainContentPos, librevenge::RVNG_SEEK_SET);
+  int level=zone.getRecordLevel();
+  try {
+    return readSWContent(zone, content);
+  }
+  catch (...) {
+    STOFF_DEBUG_MSG(("StarObjectText::readMainContent: catch an exception\n"));
+  }
+  // the zone may be read again, so close the records opened before the exception
+  zone.resetRecordLevel(level);
+  return false;
+}
+
+bool StarObjectText::readSWContent(StarZone &zone, StarObjectTextInternal::Content &content)
 {
   STOFFInputStreamPtr input=zone.input();
   libstoff::DebugFile &ascFile=zone.ascii();
@@ -966,11 +1248,6 @@ bool StarObjectText::readSWContent(StarZone &zone, std::shared_ptr<StarObjectTex
     return false;
   }
   // sw_sw3sectn.cxx: InContents
-  if (content) {
-    STOFF_DEBUG_MSG(("StarObjectText::readSWContent: oops, the content zone is already created\n"));
-  }
-  else
-    content.reset(new StarObjectTextInternal::Content);
   libstoff::DebugStream f;
   f << "Entries(SWContent)[" << zone.getRecordLevel() << "]:";
   if (zone.isCompatibleWith(5))
@@ -982,10 +1259,10 @@ bool StarObjectText::readSWContent(StarZone &zone, std::shared_ptr<StarObjectTex
     if (zone.isCompatibleWith(5)) {
       auto id=int(input->readULong(2));
       // dummy sectid, so probably ok if we do not find the pool name
-      if (id>=zone.getNumPoolNames() || !zone.getPoolName(id, content->m_sectionName))
+      if (id>=zone.getNumPoolNames() || !zone.getPoolName(id, content.m_sectionName))
         f << "#sectId=" << id << ",";
       else
-        f << "section[name]=" << content->m_sectionName.cstr() << ",";
+        f << "section[name]=" << content.m_sectionName.cstr() << ",";
     }
     nNodes=int(input->readULong(2));
   }
@@ -1008,7 +1285,7 @@ bool StarObjectText::readSWContent(StarZone &zone, std::shared_ptr<StarObjectTex
       if (done) {
         std::shared_ptr<StarObjectTextInternal::Table> tableZone(new StarObjectTextInternal::Table);
         tableZone->m_table=table;
-        content->m_zoneList.push_back(tableZone);
+        content.addZone(tableZone);
       }
       break;
     }
@@ -1016,28 +1293,28 @@ bool StarObjectText::readSWContent(StarZone &zone, std::shared_ptr<StarObjectTex
       std::shared_ptr<StarObjectTextInternal::GraphZone> graph;
       done=readSWGraphNode(zone, graph);
       if (done && graph)
-        content->m_zoneList.push_back(graph);
+        content.addZone(graph);
       break;
     }
     case 'I': {
       std::shared_ptr<StarObjectTextInternal::SectionZone> section;
       done=readSWSection(zone, section);
       if (done && section)
-        content->m_zoneList.push_back(section);
+        content.addZone(section);
       break;
     }
     case 'O': {
       std::shared_ptr<StarObjectTextInternal::OLEZone> ole;
       done=readSWOLENode(zone, ole);
       if (done && ole)
-        content->m_zoneList.push_back(ole);
+        content.addZone(ole);
       break;
     }
     case 'T': {
       std::shared_ptr<StarObjectTextInternal::TextZone> text;
       done=readSWTextZone(zone, text);
       if (done && text)
-        content->m_zoneList.push_back(text);
+        content.addZone(text);
       break;
     }
     case 'l': // related to link
@@ -1047,7 +1324,7 @@ bool StarObjectText::readSWContent(StarZone &zone, std::shared_ptr<StarObjectTex
       if (done && format) {
         std::shared_ptr<StarObjectTextInternal::FormatZone> formatZone;
         formatZone.reset(new StarObjectTextInternal::FormatZone(format));
-        content->m_zoneList.push_back(formatZone);
+        content.addZone(formatZone);
       }
       break;
     }
@@ -1475,7 +1752,8 @@ bool StarObjectText::readSWTextZone(StarZone &zone, std::shared_ptr<StarObjectTe
     f << "nCondColl=" << input->readULong(2) << ",";
   zone.closeFlagZone();
 
-  if (!zone.readString(textZone->m_text, textZone->m_textSourcePosition, -1, true)) {
+  auto &text=m_textState->m_readText;
+  if (!zone.readString(text, m_textState->m_readTextSourcePosition, -1, true)) {
     STOFF_DEBUG_MSG(("StarObjectText::readSWTextZone: can not read main text\n"));
     f << "###text";
     ascFile.addPos(pos);
@@ -1483,8 +1761,9 @@ bool StarObjectText::readSWTextZone(StarZone &zone, std::shared_ptr<StarObjectTe
     zone.closeSWRecord('T', "SWText");
     return true;
   }
-  else if (!textZone->m_text.empty())
-    f << libstoff::getString(textZone->m_text).cstr();
+  else if (!text.empty())
+    f << libstoff::getString(text).cstr();
+  m_textState->storeReadText(*textZone);
 
   ascFile.addPos(pos);
   ascFile.addNote(f.str().c_str());
@@ -1710,7 +1989,9 @@ catch (...)
 bool StarObjectText::readWriterDocument(STOFFInputStreamPtr input, std::string const &name)
 try
 {
-  StarZone zone(input, name, "SWWriterDocument", getPassword());
+  // the zone is kept if we need to read the main content again
+  std::shared_ptr<StarZone> zonePtr(new StarZone(input, name, "SWWriterDocument", getPassword()));
+  auto &zone=*zonePtr;
   if (!zone.readSWHeader()) {
     STOFF_DEBUG_MSG(("StarObjectText::readWriterDocument: can not read the header\n"));
     return false;
@@ -1722,6 +2003,18 @@ try
   while (!input->isEnd()) {
     long pos=input->tell();
     int rType=input->peek();
+    if (isTextOnly() && (rType=='8' || rType=='D' || rType=='J' || rType=='M' || rType=='U' ||
+                         rType=='V' || rType=='a' || rType=='d' || rType=='j')) {
+      // the layout, the printer settings, ... are not needed to retrieve the text: skip them
+      unsigned char type;
+      if (zone.openSWRecord(type)) {
+        long lastPos=zone.getRecordLastPosition();
+        if (lastPos) input->seek(lastPos, librevenge::RVNG_SEEK_SET);
+        zone.closeSWRecord(type, "SWWriterDocument");
+        if (lastPos) continue;
+      }
+      input->seek(pos, librevenge::RVNG_SEEK_SET);
+    }
     bool done=false;
     switch (rType) {
     case '!':
@@ -1764,9 +2057,58 @@ try
       done=StarWriterStruct::Macro::readList(zone, macroList);
       break;
     }
-    case 'N':
-      done=readSWContent(zone, m_textState->m_mainContent);
+    case 'N': {
+      if (m_textState->m_mainContent || m_textState->m_mainContentZone) {
+        m_textState->m_pageInventoryDone=false;
+        done=readSWContent(zone, m_textState->m_mainContent);
+        break;
+      }
+      // a big main content is not stored: its zones will be read and
+      // sent one by one
+      unsigned char type;
+      if (!zone.openSWRecord(type))
+        break;
+      long lastPos=zone.getRecordLastPosition();
+      if (lastPos) input->seek(lastPos, librevenge::RVNG_SEEK_SET);
+      zone.closeSWRecord(type, "SWContent");
+      bool streamed=type=='N' && lastPos>=pos+StarObjectTextInternal::State::s_minStreamedContentSize;
+      input->seek(pos, librevenge::RVNG_SEEK_SET);
+      // inventory the pages while reading the content, so that
+      // updatePageSpans does not need to walk through it again
+      std::shared_ptr<StarObjectTextInternal::Content> mainContent;
+      if (!streamed)
+        mainContent.reset(new StarObjectTextInternal::Content);
+      auto pool=findItemPool(StarItemPool::T_WriterPool, false);
+      StarState state(pool.get(), *this);
+      state.m_global->m_objectModel=m_textState->m_model;
+      StarObjectTextInternal::InventoryContent content(state, mainContent);
+      int level=zone.getRecordLevel();
+      try {
+        done=readSWContent(zone, content);
+      }
+      catch (...) {
+        STOFF_DEBUG_MSG(("StarObjectText::readWriterDocument: catch an exception when reading the main content\n"));
+        // close the records opened before the exception, so that the next zones can be read
+        zone.resetRecordLevel(level);
+        done=false;
+      }
+      if (!done)
+        break;
+      if (pool) {
+        m_textState->m_pageInventoryDone=true;
+        m_textState->m_pageNameList=state.m_global->m_pageNameList;
+      }
+      if (streamed) {
+        m_textState->m_mainContentZone=zonePtr;
+        m_textState->m_mainContentPos=pos;
+        input->seek(lastPos, librevenge::RVNG_SEEK_SET);
+      }
+      else {
+        mainContent->m_sectionName=content.m_sectionName;
+        m_textState->m_mainContent=mainContent;
+      }
       break;
+    }
     case 'U': { // layout info, no code, ignored by LibreOffice
       StarLayout layout;
       done=layout.read(zone, *this);
@@ -72,7 +72,12 @@ struct Content {
   {
   }
   //! destructor
-  ~Content();
+  virtual ~Content();
+  //! adds a zone read in the file (by default, stores it in m_zoneList)
+  virtual void addZone(std::shared_ptr<Zone> zone)
+  {
+    m_zoneList.push_back(zone);
+  }
   //! try to send the data to a listener
   bool send(STOFFListenerPtr &listener, StarState &state, bool isFlyer=false) const;
   //! try to inventory the different pages
@@ -132,6 +137,10 @@ protected:
   bool readDrawingLayer(STOFFInputStreamPtr input, std::string const &fileName);
 
 protected:
+  //! try to read some content : 'N', the zones are given to content.addZone
+  bool readSWContent(StarZone &zone, StarObjectTextInternal::Content &content);
+  //! try to read the main content again, when it has not been stored
+  bool readMainContent(StarObjectTextInternal::Content &content);
   //! try to read a OLE node : 'g'
   bool readSWGraphNode(StarZone &zone, std::shared_ptr<StarObjectTextInternal::GraphZone> &graphZone);
   //! try to read a SW zone setup : 'J'
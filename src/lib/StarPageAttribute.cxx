@@ -62,7 +62,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarPAttributeBool(*this));
   }
   //! add to a page
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 
 protected:
   //! copy constructor
@@ -86,7 +86,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarPAttributeColor(*this));
   }
   //! add to a page
-  // void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  // void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 protected:
   //! copy constructor
   StarPAttributeColor(StarPAttributeColor const &) = default;
@@ -107,7 +107,7 @@ public:
   //! destructor
   ~StarPAttributeInt() override;
   //! add to a page
-  // void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  // void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! create a new attribute
   std::shared_ptr<StarAttribute> create() const final
   {
@@ -137,7 +137,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarPAttributeUInt(*this));
   }
   //! add to a page
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 protected:
   //! copy constructor
   StarPAttributeUInt(StarPAttributeUInt const &) = default;
@@ -154,7 +154,7 @@ public:
   //! destructor
   ~StarPAttributeVoid() final;
   //! add to a page
-  // void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const nfinal;
+  // void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const nfinal;
   //! create a new attribute
   std::shared_ptr<StarAttribute> create() const final
   {
@@ -184,7 +184,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarPAttributeItemSet(*this));
   }
   //! add to a pageSpan
-  void addTo(StarState &state, std::set<StarAttribute const *> &done) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &done) const final;
 
 protected:
   //! copy constructor
@@ -206,13 +206,13 @@ public:
     return std::shared_ptr<StarAttribute>(new StarPAttributeVec2i(*this));
   }
   //! add to a pageSpan
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 protected:
   //! copy constructor
   StarPAttributeVec2i(StarPAttributeVec2i const &) = default;
 };
 
-void StarPAttributeBool::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeBool::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_SC_PAGE_HORCENTER) {
     if (state.m_global->m_pageZone==0) {
@@ -261,7 +261,7 @@ void StarPAttributeBool::addTo(StarState &state, std::set<StarAttribute const *>
   }
 }
 
-void StarPAttributeUInt::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeUInt::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_SC_PAGE_SCALE) {
     if (state.m_global->m_pageZone==0) {
@@ -285,7 +285,7 @@ void StarPAttributeUInt::addTo(StarState &state, std::set<StarAttribute const *>
   }
 }
 
-void StarPAttributeVec2i::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeVec2i::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type!=ATTR_SC_PAGE_SIZE)
     return;
@@ -297,9 +297,9 @@ void StarPAttributeVec2i::addTo(StarState &state, std::set<StarAttribute const *
     state.m_global->m_page.m_propertiesList[state.m_global->m_pageZone].insert("fo:min-height", double(m_value[1])/1440., librevenge::RVNG_INCH);
 }
 
-void StarPAttributeItemSet::addTo(StarState &state, std::set<StarAttribute const *> &done) const
+void StarPAttributeItemSet::addTo(StarState &state, StarAttributeDoneSet &done) const
 {
-  if (done.find(this)!=done.end()) {
+  if (done.contains(this)) {
     STOFF_DEBUG_MSG(("StarPAttributeItemSet::addTo: find a cycle\n"));
     return;
   }
@@ -466,7 +466,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarPAttributeColumns(*this));
   }
   //! add to a page
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! debug function to print the data
@@ -535,7 +535,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarPAttributeFrameHF(*this));
   }
   //! add to a page
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! debug function to print the data
@@ -580,7 +580,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarPAttributePage(*this));
   }
   //! add to a page
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! debug function to print the data
@@ -635,7 +635,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarPAttributePageDesc(*this));
   }
   //! add to a page
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! debug function to print the data
@@ -674,7 +674,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarPAttributePageHF(*this));
   }
   //! add to a page
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! debug function to print the data
@@ -779,7 +779,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarPAttributeViewMode(*this));
   }
   //! add to a page
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! try to read a field
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final
   {
@@ -812,7 +812,7 @@ protected:
   StarPAttributeViewMode(StarPAttributeViewMode const &) = default;
 };
 
-void StarPAttributeColumns::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeColumns::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_FRM_COL) {
     if (!m_columnList.empty()) {
@@ -827,7 +827,7 @@ void StarPAttributeColumns::addTo(StarState &state, std::set<StarAttribute const
   }
 }
 
-void StarPAttributePage::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributePage::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type!=ATTR_SC_PAGE || state.m_global->m_pageZone!=STOFFPageSpan::Page)
     return;
@@ -841,7 +841,7 @@ void StarPAttributePage::addTo(StarState &state, std::set<StarAttribute const *>
   }
 }
 
-void StarPAttributeFrameHF::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeFrameHF::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (!m_active || !m_format)
     return;
@@ -855,7 +855,7 @@ void StarPAttributeFrameHF::addTo(StarState &state, std::set<StarAttribute const
   }
 }
 
-void StarPAttributePageDesc::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributePageDesc::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (!m_name.empty()) {
     state.m_global->m_pageName=m_name;
@@ -863,7 +863,7 @@ void StarPAttributePageDesc::addTo(StarState &state, std::set<StarAttribute cons
   }
 }
 
-void StarPAttributePageHF::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributePageHF::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   bool isHeader=m_type==ATTR_SC_PAGE_HEADERLEFT || m_type==ATTR_SC_PAGE_HEADERRIGHT;
   if (!isHeader && m_type!=ATTR_SC_PAGE_FOOTERLEFT && m_type!=ATTR_SC_PAGE_FOOTERRIGHT)
@@ -880,7 +880,7 @@ void StarPAttributePageHF::addTo(StarState &state, std::set<StarAttribute const
   state.m_global->m_page.addHeaderFooter(isHeader,wh, hf);
 }
 
-void StarPAttributeViewMode::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeViewMode::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_SC_PAGE_CHARTS || m_type==ATTR_SC_PAGE_OBJECTS || m_type==ATTR_SC_PAGE_DRAWINGS) {
     if (state.m_global->m_pageZone==0 && m_value==0) {
@@ -64,7 +64,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarPAttributeBool(*this));
   }
   //! add to a para
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 
 protected:
   //! copy constructor
@@ -92,7 +92,7 @@ public:
     return std::shared_ptr<StarAttribute>(new StarPAttributeColor(*this));
   }
   //! add to a para
-  // void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  // void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 protected:
   //! copy constructor
   StarPAttributeColor(StarPAttributeColor const &) = default;
@@ -113,7 +113,7 @@ public:
   //! destructor
   ~StarPAttributeInt() final;
   //! add to a para
-  // void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  // void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! create a new attribute
   std::shared_ptr<StarAttribute> create() const final
   {
@@ -164,7 +164,7 @@ public:
     return StarAttributeUInt::read(zone, vers, endPos, object);
   }
   //! add to a para
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
 protected:
   //! copy constructor
   StarPAttributeUInt(StarPAttributeUInt const &) = default;
@@ -185,7 +185,7 @@ public:
   //! destructor
   ~StarPAttributeVoid() final;
   //! add to a para
-  // void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  // void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! create a new attribute
   std::shared_ptr<StarAttribute> create() const final
   {
@@ -200,39 +200,39 @@ StarPAttributeVoid::~StarPAttributeVoid()
 {
 }
 
-void StarPAttributeBool::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeBool::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_PARA_SPLIT)
-    state.m_paragraph.m_propertyList.insert("fo:keep-together", m_value ? "auto" : "always");
+    state.m_paragraph->m_propertyList.insert("fo:keep-together", m_value ? "auto" : "always");
   else if (m_type==ATTR_PARA_HANGINGPUNCTUATION)
-    state.m_paragraph.m_propertyList.insert("style:punctuation-wrap", m_value ? "hanging" : "simple");
+    state.m_paragraph->m_propertyList.insert("style:punctuation-wrap", m_value ? "hanging" : "simple");
   else if (m_type==ATTR_PARA_SNAPTOGRID)
-    state.m_paragraph.m_propertyList.insert("style:snap-to-layout-grid", m_value);
+    state.m_paragraph->m_propertyList.insert("style:snap-to-layout-grid", m_value);
   else if (m_type==ATTR_PARA_CONNECT_BORDER)
-    state.m_paragraph.m_propertyList.insert("style:join-border", m_value);
+    state.m_paragraph->m_propertyList.insert("style:join-border", m_value);
   else if (m_type==ATTR_EE_PARA_ASIANCJKSPACING)
-    state.m_paragraph.m_propertyList.insert("style:font-independent-line-spacing", !m_value);
+    state.m_paragraph->m_propertyList.insert("style:font-independent-line-spacing", !m_value);
 }
 
-void StarPAttributeUInt::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeUInt::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_PARA_ORPHANS)
-    state.m_paragraph.m_propertyList.insert("fo:orphans", int(m_value));
+    state.m_paragraph->m_propertyList.insert("fo:orphans", int(m_value));
   else if (m_type==ATTR_PARA_WIDOWS)
-    state.m_paragraph.m_propertyList.insert("fo:widows", int(m_value));
+    state.m_paragraph->m_propertyList.insert("fo:widows", int(m_value));
   else if (m_type==ATTR_PARA_VERTALIGN) {
     if (m_value<=4) {
       char const *wh[]= {"auto", "baseline", "top", "middle", "bottom"};
-      state.m_paragraph.m_propertyList.insert("style:vertical-align", wh[m_value]);
+      state.m_paragraph->m_propertyList.insert("style:vertical-align", wh[m_value]);
     }
     else {
       STOFF_DEBUG_MSG(("StarPAttributeUInt::addTo: unknown vertical align %d\n", int(m_value)));
     }
   }
   else if (m_type==ATTR_EE_PARA_BULLETSTATE)
-    state.m_paragraph.m_bulletVisible=m_value!=0;
+    state.m_paragraph->m_bulletVisible=m_value!=0;
   else if (m_type==ATTR_EE_PARA_OUTLLEVEL)
-    state.m_paragraph.m_listLevelIndex=int(m_value);
+    state.m_paragraph->m_listLevelIndex=int(m_value);
 }
 
 //! add a bool attribute
@@ -285,7 +285,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a para
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -325,7 +325,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a para
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -368,7 +368,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a para
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -405,7 +405,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a para
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -460,7 +460,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a para
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -509,7 +509,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a para
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -555,7 +555,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a para
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const final
   {
@@ -624,7 +624,7 @@ public:
   //! read a zone
   bool read(StarZone &zone, int vers, long endPos, StarObject &object) final;
   //! add to a para
-  void addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const final;
+  void addTo(StarState &state, StarAttributeDoneSet &/*done*/) const final;
   //! debug function to print the data
   void printData(libstoff::DebugStream &o) const override
   {
@@ -640,28 +640,28 @@ protected:
   std::vector<TabStop> m_tabList;
 };
 
-void StarPAttributeAdjust::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeAdjust::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_PARA_ADJUST) {
     switch (m_adjust) {
     case 0:
-      state.m_paragraph.m_propertyList.insert("fo:text-align", "left");
+      state.m_paragraph->m_propertyList.insert("fo:text-align", "left");
       break;
     case 1:
-      state.m_paragraph.m_propertyList.insert("fo:text-align", "right");
+      state.m_paragraph->m_propertyList.insert("fo:text-align", "right");
       break;
     case 2: // block
-      state.m_paragraph.m_propertyList.insert("fo:text-align", "justify");
-      state.m_paragraph.m_propertyList.insert("fo:text-align-last", "default");
+      state.m_paragraph->m_propertyList.insert("fo:text-align", "justify");
+      state.m_paragraph->m_propertyList.insert("fo:text-align-last", "default");
       break;
     case 3:
-      state.m_paragraph.m_propertyList.insert("fo:text-align", "center");
+      state.m_paragraph->m_propertyList.insert("fo:text-align", "center");
       break;
     case 4: // blockline
-      state.m_paragraph.m_propertyList.insert("fo:text-align", "justify");
+      state.m_paragraph->m_propertyList.insert("fo:text-align", "justify");
       break;
     case 5:
-      state.m_paragraph.m_propertyList.insert("fo:text-align", "end");
+      state.m_paragraph->m_propertyList.insert("fo:text-align", "end");
       break;
     default:
       STOFF_DEBUG_MSG(("StarPAttributeAdjust::addTo: unknown adjust %d\n", int(m_adjust)));
@@ -669,7 +669,7 @@ void StarPAttributeAdjust::addTo(StarState &state, std::set<StarAttribute const
   }
 }
 
-void StarPAttributeBulletNumeric::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeBulletNumeric::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_EE_PARA_NUMBULLET) {
     STOFFListLevel level;
@@ -685,17 +685,17 @@ void StarPAttributeBulletNumeric::addTo(StarState &state, std::set<StarAttribute
       libstoff::appendUnicode(0x2022, bullet); // checkme
       level.m_propertyList.insert("text:bullet-char", bullet);
     }
-    state.m_paragraph.m_listLevel=level;
+    state.m_paragraph->m_listLevel=level;
   }
 }
 
-void StarPAttributeBulletSimple::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeBulletSimple::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_EE_PARA_BULLET)
-    state.m_paragraph.m_listLevel=m_level;
+    state.m_paragraph->m_listLevel=m_level;
 }
 
-void StarPAttributeDrop::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeDrop::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_PARA_DROP) {
     librevenge::RVNGPropertyList cap;
@@ -704,41 +704,41 @@ void StarPAttributeDrop::addTo(StarState &state, std::set<StarAttribute const *>
     cap.insert("style:lines", m_numLines);
     librevenge::RVNGPropertyListVector capVector;
     capVector.append(cap);
-    state.m_paragraph.m_propertyList.insert("style:drop-cap", capVector);
+    state.m_paragraph->m_propertyList.insert("style:drop-cap", capVector);
   }
 }
 
-void StarPAttributeHyphen::addTo(StarState &/*state*/, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeHyphen::addTo(StarState &/*state*/, StarAttributeDoneSet &/*done*/) const
 {
 }
 
-void StarPAttributeLineSpacing::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeLineSpacing::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_type==ATTR_PARA_LINESPACING) {
     // svx_paraitem.cxx SvxLineSpacingItem::QueryValue
     if (m_interLineSpaceRule==0)
-      state.m_paragraph.m_propertyList.insert("fo:line-height", "normal");
+      state.m_paragraph->m_propertyList.insert("fo:line-height", "normal");
     switch (m_lineSpaceRule) {
     case 0: // will be set later
       break;
     case 1:
-      state.m_paragraph.m_propertyList.insert("fo:line-height", state.m_global->m_relativeUnit*double(m_lineHeight), librevenge::RVNG_POINT);
+      state.m_paragraph->m_propertyList.insert("fo:line-height", state.m_global->m_relativeUnit*double(m_lineHeight), librevenge::RVNG_POINT);
       return;
     case 2:
-      state.m_paragraph.m_propertyList.insert("fo:line-height-at-least", state.m_global->m_relativeUnit*double(m_lineHeight), librevenge::RVNG_POINT);
+      state.m_paragraph->m_propertyList.insert("fo:line-height-at-least", state.m_global->m_relativeUnit*double(m_lineHeight), librevenge::RVNG_POINT);
       return;
     default:
       STOFF_DEBUG_MSG(("StarPAttributeLineSpacing::addTo: unknown rule %d\n", int(m_lineSpaceRule)));
     }
     switch (m_interLineSpaceRule) {
     case 0: // off
-      state.m_paragraph.m_propertyList.insert("fo:line-height", 1., librevenge::RVNG_PERCENT);
+      state.m_paragraph->m_propertyList.insert("fo:line-height", 1., librevenge::RVNG_PERCENT);
       break;
     case 1: // Prop
-      state.m_paragraph.m_propertyList.insert("fo:line-height", double(m_propLineSpace)/100., librevenge::RVNG_PERCENT);
+      state.m_paragraph->m_propertyList.insert("fo:line-height", double(m_propLineSpace)/100., librevenge::RVNG_PERCENT);
       break;
     case 2: // Fix
-      state.m_paragraph.m_propertyList.insert("fo:line-height", state.m_global->m_relativeUnit*double(m_interLineSpace), librevenge::RVNG_POINT);
+      state.m_paragraph->m_propertyList.insert("fo:line-height", state.m_global->m_relativeUnit*double(m_interLineSpace), librevenge::RVNG_POINT);
       break;
     default:
       STOFF_DEBUG_MSG(("StarPAttributeLineSpacing::addTo: unknown inter linse spacing rule %d\n", int(m_interLineSpaceRule)));
@@ -746,14 +746,14 @@ void StarPAttributeLineSpacing::addTo(StarState &state, std::set<StarAttribute c
   }
 }
 
-void StarPAttributeNumericRuler::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeNumericRuler::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   if (m_name.empty() || !state.m_global->m_numericRuler)
     return;
   state.m_global->m_list=state.m_global->m_numericRuler->getList(m_name);
 }
 
-void StarPAttributeTabStop::addTo(StarState &state, std::set<StarAttribute const *> &/*done*/) const
+void StarPAttributeTabStop::addTo(StarState &state, StarAttributeDoneSet &/*done*/) const
 {
   librevenge::RVNGPropertyListVector tabs;
   for (auto const &tabStop : m_tabList) {
@@ -790,7 +790,7 @@ void StarPAttributeTabStop::addTo(StarState &state, std::set<StarAttribute const
     tab.insert("style:position", state.m_global->m_relativeUnit*double(tabStop.m_pos), librevenge::RVNG_POINT);
     tabs.append(tab);
   }
-  state.m_paragraph.m_propertyList.insert("style:tab-stops", tabs);
+  state.m_paragraph->m_propertyList.insert("style:tab-stops", tabs);
 }
 
 bool StarPAttributeAdjust::read(StarZone &zone, int vers, long endPos, StarObject &/*object*/)
@@ -38,6 +38,7 @@
 #ifndef STAR_STATE_HXX
 #  define STAR_STATE_HXX
 
+#include <memory>
 #include <vector>
 
 #include "libstaroffice_internal.hxx"
@@ -62,7 +63,71 @@ namespace SWFieldManagerInternal
 struct Field;
 }
 
+/** \brief a style which can be shared by some states, the style is
+    only duplicated when a state which shares it modifies it (copy on
+    write)
+
+    \note the non const accessors (operator* and operator->) duplicate the
+    style if it is shared, so get() must be used to only read the style.
+ */
+template <class T> class StarCopyOnWrite
+{
+public:
+  //! constructor: creates a default style
+  StarCopyOnWrite()
+    : m_data()
+  {
+  }
+  //! reset the style to a new value
+  StarCopyOnWrite &operator=(T const &data)
+  {
+    if (m_data && m_data.use_count()==1)
+      *m_data=data;
+    else
+      m_data.reset(new T(data));
+    return *this;
+  }
+  //! returns the style (for reading)
+  T const &get() const
+  {
+    if (m_data) return *m_data;
+    static T const defaultData;
+    return defaultData;
+  }
+  //! returns the style (for reading)
+  T const &operator*() const
+  {
+    return get();
+  }
+  //! returns the style (for reading)
+  T const *operator->() const
+  {
+    return &get();
+  }
+  //! returns the style (for modification)
+  T &operator*()
+  {
+    if (!m_data)
+      m_data.reset(new T);
+    else if (m_data.use_count()>1)
+      m_data.reset(new T(*m_data));
+    return *m_data;
+  }
+  //! returns the style (for modification)
+  T *operator->()
+  {
+    return &**this;
+  }
+protected:
+  //! the style data, the empty pointer means a default style
+  std::shared_ptr<T> m_data;
+};
+
 /** \brief class to store an state: ie. the current page, section, ... style
+
+    \note the styles (cell, frame, graphic, paragraph, font) are shared
+    between a state and its copies until one of them is modified, so
+    copying a state is cheap
  */
 class StarState
 {
@@ -170,16 +235,16 @@ public:
   int m_break;
 
   /// the cell style
-  STOFFCellStyle m_cell;
+  StarCopyOnWrite<STOFFCellStyle> m_cell;
   /// the frame style
-  STOFFFrameStyle m_frame;
+  StarCopyOnWrite<STOFFFrameStyle> m_frame;
   /// the graphic style
-  STOFFGraphicStyle m_graphic;
+  StarCopyOnWrite<STOFFGraphicStyle> m_graphic;
 
   /// the paragraph style
-  STOFFParagraph m_paragraph;
+  StarCopyOnWrite<STOFFParagraph> m_paragraph;
   /// the font
-  STOFFFont m_font;
+  StarCopyOnWrite<STOFFFont> m_font;
   /// flag to know if this is a content zone
   bool m_content;
   /// flag to know if this is a flyCnt
@@ -196,6 +196,15 @@ public:
   {
     return int(m_positionStack.size());
   }
+  //! closes the records opened after a record level, ie. when an exception has been thrown
+  void resetRecordLevel(int level)
+  {
+    m_flagEndZone=0;
+    while (int(m_positionStack.size())>level) {
+      m_typeStack.pop();
+      m_positionStack.pop();
+    }
+  }
   //! returns the actual record last position
   long getRecordLastPosition() const
   {
@@ -34,6 +34,7 @@
 #include <cmath>
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <iomanip>
 #include <string>
 #include <sstream>
@@ -78,7 +79,8 @@ librevenge::RVNGString getString(std::vector<uint32_t> const &unicode)
   return res;
 }
 
-void appendUnicode(uint32_t val, librevenge::RVNGString &buffer)
+//! writes the UTF-8 encoding of a character in outbuf (which must have at least 7 bytes)
+static void encodeUnicode(uint32_t val, char *outbuf)
 {
   uint8_t first;
   int len;
@@ -107,7 +109,6 @@ void appendUnicode(uint32_t val, librevenge::RVNGString &buffer)
     len = 6;
   }
 
-  char outbuf[7];
   int i;
   for (i = len - 1; i > 0; --i) {
     outbuf[i] = char((val & 0x3f) | 0x80);
@@ -115,8 +116,21 @@ void appendUnicode(uint32_t val, librevenge::RVNGString &buffer)
   }
   outbuf[0] = char(val | first);
   outbuf[len] = 0;
+}
+
+void appendUnicode(uint32_t val, librevenge::RVNGString &buffer)
+{
+  char outbuf[7];
+  encodeUnicode(val, outbuf);
   buffer.append(outbuf);
 }
+
+void appendUnicode(uint32_t val, std::string &buffer)
+{
+  char outbuf[7];
+  encodeUnicode(val, outbuf);
+  buffer+=outbuf;
+}
 }
 
 namespace libstoff
@@ -427,6 +441,56 @@ void splitString(librevenge::RVNGString const &string, librevenge::RVNGString co
     string1=string;
 }
 
+size_t RVNGStringHash::operator()(librevenge::RVNGString const &s) const
+{
+  // FNV-1a
+  size_t res=size_t(2166136261U);
+  for (char const *ptr=s.cstr(); ptr && *ptr; ++ptr)
+    res=(res^size_t(static_cast<unsigned char>(*ptr)))*size_t(16777619U);
+  return res;
+}
+
+int comparePropertyList(librevenge::RVNGPropertyList const &list1, librevenge::RVNGPropertyList const &list2)
+{
+  if (&list1==&list2) return 0;
+  librevenge::RVNGPropertyList::Iter it1(list1), it2(list2);
+  it1.rewind();
+  it2.rewind();
+  while (true) {
+    bool hasNext1=it1.next(), hasNext2=it2.next();
+    if (!hasNext1 || !hasNext2)
+      return hasNext1 ? 1 : hasNext2 ? -1 : 0;
+    int diff=strcmp(it1.key(), it2.key());
+    if (diff) return diff<0 ? -1 : 1;
+    auto child1=it1.child(), child2=it2.child();
+    if (child1 || child2) {
+      if (!child1 || !child2) return child1 ? 1 : -1;
+      diff=comparePropertyListVector(*child1, *child2);
+      if (diff) return diff;
+      continue;
+    }
+    auto prop1=it1(), prop2=it2();
+    if (!prop1 || !prop2) {
+      if (prop1 || prop2) return prop1 ? 1 : -1;
+      continue;
+    }
+    diff=strcmp(prop1->getStr().cstr(), prop2->getStr().cstr());
+    if (diff) return diff<0 ? -1 : 1;
+  }
+}
+
+int comparePropertyListVector(librevenge::RVNGPropertyListVector const &vect1, librevenge::RVNGPropertyListVector const &vect2)
+{
+  if (&vect1==&vect2) return 0;
+  unsigned long count1=vect1.count(), count2=vect2.count();
+  if (count1!=count2) return count1<count2 ? -1 : 1;
+  for (unsigned long i=0; i<count1; ++i) {
+    int diff=comparePropertyList(vect1[i], vect2[i]);
+    if (diff) return diff;
+  }
+  return 0;
+}
+
 librevenge::RVNGString simplifyString(librevenge::RVNGString const &s)
 {
   librevenge::RVNGString res("");
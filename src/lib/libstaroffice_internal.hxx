@@ -159,6 +159,8 @@ namespace libstoff
 uint8_t readU8(librevenge::RVNGInputStream *input);
 //! adds an unicode character to a string
 void appendUnicode(uint32_t val, librevenge::RVNGString &buffer);
+//! adds an unicode character to a string
+void appendUnicode(uint32_t val, std::string &buffer);
 //! transform a unicode string in a RNVGString
 librevenge::RVNGString getString(std::vector<uint32_t> const &unicode);
 
@@ -1143,6 +1145,26 @@ void splitString(librevenge::RVNGString const &string, librevenge::RVNGString co
 
  \note this function is mainly used to try to test for searching a string when some encoding problem has happens*/
 librevenge::RVNGString simplifyString(librevenge::RVNGString const &s);
+//! small struct used to hash a RVNGString without creating a std::string
+struct RVNGStringHash {
+  //! the hash function
+  size_t operator()(librevenge::RVNGString const &s) const;
+};
+/** compares two property lists key by key, the children being compared recursively.
+
+    \note this avoids to create the getPropString of the two lists, which is slow
+ */
+int comparePropertyList(librevenge::RVNGPropertyList const &list1, librevenge::RVNGPropertyList const &list2);
+//! compares two property list vectors, see comparePropertyList
+int comparePropertyListVector(librevenge::RVNGPropertyListVector const &vect1, librevenge::RVNGPropertyListVector const &vect2);
+//! small structure used to store property lists in a map
+struct PropertyListLess {
+  //! comparison function
+  bool operator()(librevenge::RVNGPropertyList const &list1, librevenge::RVNGPropertyList const &list2) const
+  {
+    return comparePropertyList(list1, list2)<0;
+  }
+};
 //! returns the cell name corresponding to a cell's position
 std::string getCellName(STOFFVec2i const &cellPos, STOFFVec2b const &relative=STOFFVec2b(true,true));
 // some geometrical function